@@ -0,0 +1,591 @@
+//
+// benchmark.cpp
+//
+// Timing runs kept out of the default test pass. Run them with
+// --gtest_also_run_disabled_tests --gtest_filter=*benchmark*
+//
+
+#include "pch.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <forward_list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <random>
+
+namespace {
+
+	std::atomic<std::size_t> allocations{ 0 };
+}
+
+// Counting replacements of the global allocation functions; the array and sized forms
+// forward here by default. GCC sees these inlined next to the new-expression and reports
+// the malloc/free pairing as mismatched, which it is not.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(std::size_t size) {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size ? size : 1)) {
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+	template <class Action>
+	double measure_ms(Action action) {
+		auto start = std::chrono::steady_clock::now();
+		action();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template <class List>
+	void build_and_scan(const char* name, std::size_t count) {
+		List* instance = nullptr;
+		double build = measure_ms([&] {
+			instance = new List();
+			for (std::size_t i = 0; i < count; i++)
+			{
+				instance->push_front(static_cast<int>(i));
+			}
+		});
+		long long sum = 0;
+		double scan = measure_ms([&] {
+			for (int value : *instance) {
+				sum += value;
+			}
+		});
+		double destroy = measure_ms([&] { delete instance; });
+		std::cout << name << " x" << count << ": build " << build << " ms, scan " << scan
+			<< " ms, destroy " << destroy << " ms (checksum " << sum << ")" << std::endl;
+	}
+
+	// Every thread alternates push_front and pop_front on the shared list.
+	template <class PushPop>
+	void push_pop_throughput(const char* name, unsigned threadCount, std::size_t operations, PushPop pushPop) {
+		std::vector<std::thread> threads;
+		double elapsed = measure_ms([&] {
+			for (unsigned t = 0; t < threadCount; t++)
+			{
+				threads.emplace_back([&] {
+					for (std::size_t i = 0; i < operations; i++)
+					{
+						pushPop(static_cast<int>(i));
+					}
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+		});
+		std::cout << name << " threads " << threadCount << ": "
+			<< threadCount * operations / elapsed / 1000.0 << " Mops/s" << std::endl;
+	}
+
+	// Builds count short keys and reports the heap allocations and time it took.
+	template <class String>
+	void short_strings(const char* name, std::size_t count) {
+		std::vector<String> keys;
+		keys.reserve(count);
+		std::size_t before = allocations.load();
+		double elapsed = measure_ms([&] {
+			for (std::size_t i = 0; i < count; i++)
+			{
+				keys.emplace_back("key_");
+				keys.back().push_back(static_cast<char>('a' + i % 26));
+			}
+		});
+		std::cout << name << " x" << count << ": " << allocations.load() - before
+			<< " allocations, " << elapsed << " ms" << std::endl;
+	}
+}
+
+TEST(forward_list_benchmark, DISABLED_destruction_scales_linearly) {
+	for (std::size_t count = 10000; count <= 10000000; count *= 10)
+	{
+		auto instance = new my_std::forward_list<int>();
+		for (std::size_t i = 0; i < count; i++)
+		{
+			instance->push_back(static_cast<int>(i));
+		}
+		double elapsed = measure_ms([&] { delete instance; });
+		std::cout << count << " nodes: " << elapsed << " ms, "
+			<< elapsed * 1e6 / count << " ns/node" << std::endl;
+	}
+}
+
+TEST(forward_list_benchmark, DISABLED_unrolled_against_linked) {
+	for (std::size_t count = 100000; count <= 10000000; count *= 10)
+	{
+		build_and_scan<std::forward_list<int>>("std::forward_list", count);
+		build_and_scan<my_std::forward_list<int>>("my_std::forward_list", count);
+		build_and_scan<my_std::unrolled_forward_list<int, 16>>("my_std::unrolled_forward_list<16>", count);
+	}
+}
+
+TEST(concurrent_forward_list_benchmark, DISABLED_push_pop_scaling) {
+	const std::size_t operations = 1000000;
+	for (unsigned threadCount = 1; threadCount <= std::max(1u, std::thread::hardware_concurrency()); threadCount *= 2)
+	{
+		my_std::concurrent_forward_list<int> lockFree;
+		push_pop_throughput("concurrent_forward_list", threadCount, operations, [&](int value) {
+			lockFree.push_front(value);
+			lockFree.pop_front();
+		});
+
+		std::mutex guard;
+		my_std::forward_list<int, std::allocator<int>> locked;
+		push_pop_throughput("mutex + forward_list", threadCount, operations, [&](int value) {
+			std::lock_guard<std::mutex> lock(guard);
+			locked.push_front(value);
+			locked.pop_front();
+		});
+	}
+}
+
+TEST(forward_list_benchmark, DISABLED_sort_in_place) {
+	for (std::size_t count = 1000000; count <= 10000000; count *= 10)
+	{
+		std::mt19937 generator(42);
+		my_std::forward_list<int> instance;
+		std::forward_list<int> reference;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			int value = static_cast<int>(generator());
+			instance.push_front(value);
+			reference.push_front(value);
+		}
+		double own = measure_ms([&] { instance.sort(); });
+		double standard = measure_ms([&] { reference.sort(); });
+		std::cout << "sort x" << count << ": my_std::forward_list " << own
+			<< " ms, std::forward_list " << standard << " ms" << std::endl;
+	}
+}
+
+TEST(universalStrign_benchmark, DISABLED_short_strings_stay_inline) {
+	const std::size_t count = 1000000;
+	short_strings<my_std::universalStrign<char>>("universalStrign<char> (small_vector)", count);
+	short_strings<my_std::universalStrign<char, std::vector<char>>>("universalStrign<char, std::vector>", count);
+}
+
+TEST(universalStrign_benchmark, DISABLED_prepend_and_strip) {
+	for (std::size_t count = 10000; count <= 1000000; count *= 10)
+	{
+		my_std::universalStrign<char> instance;
+		double prepend = measure_ms([&] {
+			for (std::size_t i = 0; i < count; i++)
+			{
+				instance.push_front(static_cast<char>('a' + i % 26));
+			}
+		});
+		double strip = measure_ms([&] {
+			while (!instance.isEmpty()) {
+				instance.pop_front();
+			}
+		});
+		std::cout << "x" << count << ": push_front " << prepend << " ms, pop_front " << strip << " ms" << std::endl;
+	}
+}
+
+TEST(universalStrign_benchmark, DISABLED_repeat_and_concat) {
+	auto piece = my_std::universalStrign<char>("0123456789abcdef0123456789abcdef");
+	std::size_t before = allocations.load();
+	my_std::universalStrign<char> repeated;
+	double repeat = measure_ms([&] { repeated = piece * 100000; });
+	std::size_t repeatAllocations = allocations.load() - before;
+	before = allocations.load();
+	double concat = measure_ms([&] { repeated = repeated + piece; });
+	std::cout << "str * 100000: " << repeat << " ms, " << repeatAllocations << " allocations; str + str: "
+		<< concat << " ms, " << allocations.load() - before << " allocations" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_tokenize_with_views) {
+	auto line = my_std::universalStrign<char>("id,timestamp,source,destination,protocol,length,flags,checksum,payload") * 20;
+	const std::size_t lines = 20000;
+	std::size_t fields = 0;
+	std::size_t before = allocations.load();
+	double viewed = measure_ms([&] {
+		for (std::size_t n = 0; n < lines; n++)
+		{
+			auto rest = my_std::universalStrign_view<char>(line);
+			for (std::size_t i = 0; i < rest.size();)
+			{
+				if (rest[i] == ',') {
+					fields += !rest.substr_view(0, i).isEmpty();
+					rest.remove_prefix(i + 1);
+					i = 0;
+				}
+				else {
+					i++;
+				}
+			}
+		}
+	});
+	std::size_t viewAllocations = allocations.load() - before;
+	before = allocations.load();
+	double copied = measure_ms([&] {
+		for (std::size_t n = 0; n < lines; n++)
+		{
+			auto rest = line;
+			for (std::size_t i = 0; i < rest.size();)
+			{
+				if (rest[i] == ',') {
+					fields += i != 0;
+					rest = rest.split(i + 1);
+					i = 0;
+				}
+				else {
+					i++;
+				}
+			}
+		}
+	});
+	std::cout << "views: " << viewed << " ms, " << viewAllocations << " allocations; copies: " << copied << " ms, "
+		<< allocations.load() - before << " allocations (" << fields << " fields)" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_sort_and_dedup) {
+	const std::size_t count = 500000;
+	std::mt19937 generator(42);
+	std::vector<my_std::universalStrign<char>> own;
+	std::vector<std::string> reference;
+	for (std::size_t i = 0; i < count; i++)
+	{
+		std::string key = "/var/log/service/requests/" + std::to_string(generator() % (count / 4));
+		own.emplace_back(key.c_str());
+		reference.push_back(key);
+	}
+	double ownSort = measure_ms([&] { std::sort(own.begin(), own.end()); });
+	double referenceSort = measure_ms([&] { std::sort(reference.begin(), reference.end()); });
+	std::size_t ownUnique = 0;
+	std::size_t referenceUnique = 0;
+	double ownDedup = measure_ms([&] { ownUnique = std::unique(own.begin(), own.end()) - own.begin(); });
+	double referenceDedup = measure_ms([&] { referenceUnique = std::unique(reference.begin(), reference.end()) - reference.begin(); });
+	std::cout << "sort x" << count << ": universalStrign " << ownSort << " ms, std::string " << referenceSort << " ms" << std::endl;
+	std::cout << "dedup: universalStrign " << ownDedup << " ms (" << ownUnique << "), std::string "
+		<< referenceDedup << " ms (" << referenceUnique << ")" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_transform_kernels) {
+	struct virtualUpper : public my_std::ITransformer<char> {
+		char operator()(char value) override { return value >= 'a' && value <= 'z' ? value - 32 : value; }
+	} perCharacter;
+	struct blockUpper : public my_std::blockTransformer<blockUpper, char> {
+		char operator()(char value) override { return value >= 'a' && value <= 'z' ? value - 32 : value; }
+	} perBlock;
+	auto text = my_std::universalStrign<char>("The quick brown fox jumps over the lazy dog. ") * 2000000;
+	double megabytes = text.size() / 1e6;
+	auto report = [&](const char* name, double elapsed) {
+		std::cout << name << ": " << elapsed << " ms, " << megabytes / elapsed * 1000.0 << " MB/s" << std::endl;
+	};
+	report("lambda", measure_ms([&] { text.transform([](char value) { return value ^ 0x20; }); }));
+	report("ascii_upper", measure_ms([&] { text.transform(my_std::ascii_upper()); }));
+	report("xor_bytes", measure_ms([&] { text.transform(my_std::xor_bytes(0x5A)); }));
+	report("lookup_table", measure_ms([&] { text.transform(my_std::lookup_table::from([](unsigned char value) { return value ^ 1; })); }));
+	report("transformDyn per character", measure_ms([&] { text.transformDyn(&perCharacter); }));
+	report("transformDyn per block", measure_ms([&] { text.transformDyn(&perBlock); }));
+}
+
+TEST(universalStrign_benchmark, DISABLED_parallel_passes) {
+	auto text = my_std::universalStrign<char>("The quick brown fox jumps over the lazy dog. ") * 4000000;
+	text[text.size() - 2] = '#';
+	auto& pool = my_std::thread_pool::shared();
+	auto checksum = [](char value) { return static_cast<long long>(value); };
+	std::size_t serialCount = 0;
+	std::size_t parallelCount = 0;
+	std::cout << "threads " << pool.size() << ", " << text.size() / 1e6 << " MB" << std::endl;
+	std::cout << "transform serial " << measure_ms([&] { text.transform(my_std::ascii_upper()); })
+		<< " ms, parallel " << measure_ms([&] { text.parallel_transform(my_std::ascii_lower(), pool); }) << " ms" << std::endl;
+	std::cout << "count serial " << measure_ms([&] { serialCount = text.parallel_count('o', pool, text.size()); })
+		<< " ms, parallel " << measure_ms([&] { parallelCount = text.parallel_count('o', pool); }) << " ms ("
+		<< serialCount << ", " << parallelCount << ")" << std::endl;
+	std::cout << "find serial " << measure_ms([&] { serialCount = text.parallel_find('#', pool, text.size()); })
+		<< " ms, parallel " << measure_ms([&] { parallelCount = text.parallel_find('#', pool); }) << " ms" << std::endl;
+	long long serialSum = 0;
+	long long parallelSum = 0;
+	std::cout << "reduce serial " << measure_ms([&] { serialSum = text.parallel_transform_reduce(0LL, std::plus<>(), checksum, pool, text.size()); })
+		<< " ms, parallel " << measure_ms([&] { parallelSum = text.parallel_transform_reduce(0LL, std::plus<>(), checksum, pool); })
+		<< " ms (" << (serialSum == parallelSum ? "equal" : "DIFFERENT") << ")" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_log_grep) {
+	std::mt19937 generator(42);
+	std::string text;
+	const char* levels[] = { "INFO", "DEBUG", "WARN" };
+	for (int i = 0; i < 400000; i++)
+	{
+		text += std::string("2024-05-01T12:00:00 ") + levels[generator() % 3] + " request served id=" + std::to_string(generator()) + "\n";
+	}
+	text += "2024-05-01T12:00:01 ERROR connection reset by peer while reading response\n";
+	auto own = my_std::universalStrign<char>(text.c_str());
+	std::cout << text.size() / 1e6 << " MB" << std::endl;
+	const char* needles[] = { "ERROR", "connection reset by peer" };
+	for (const char* needle : needles)
+	{
+		std::size_t length = std::strlen(needle);
+		std::size_t naive = 0;
+		std::size_t found = 0;
+		std::size_t standard = 0;
+		double naiveTime = measure_ms([&] {
+			for (naive = 0; naive + length <= own.size(); naive++)
+			{
+				std::size_t i = 0;
+				while (i < length && own[naive + i] == needle[i]) {
+					i++;
+				}
+				if (i == length) {
+					break;
+				}
+			}
+		});
+		auto prepared = my_std::searcher<char>(needle, length);
+		double searcherTime = measure_ms([&] { found = own.find(prepared); });
+		double standardTime = measure_ms([&] { standard = text.find(needle); });
+		std::cout << "\"" << needle << "\": operator[] loop " << naiveTime << " ms, searcher " << searcherTime
+			<< " ms, std::string::find " << standardTime << " ms (" << naive << ", " << found << ", " << standard << ")" << std::endl;
+	}
+}
+
+TEST(universalStrign_benchmark, DISABLED_stream_io) {
+	auto text = my_std::universalStrign<char>("2024-05-01T12:00:00 INFO request served\n") * 1000000;
+	std::ostringstream perCharacter;
+	std::ostringstream bulk;
+	double perCharacterTime = measure_ms([&] {
+		for (std::size_t i = 0; i < text.size(); i++)
+		{
+			perCharacter << text[i];
+		}
+	});
+	double bulkTime = measure_ms([&] { bulk << text; });
+	std::istringstream lines(bulk.str());
+	my_std::universalStrign<char> line;
+	std::size_t count = 0;
+	double getlineTime = measure_ms([&] {
+		while (getline(lines, line)) {
+			count++;
+		}
+	});
+	std::istringstream words(bulk.str());
+	std::size_t wordCount = 0;
+	double wordTime = measure_ms([&] {
+		for (my_std::universalStrign<char> word; words >> word; word.clear()) {
+			wordCount++;
+		}
+	});
+	std::cout << text.size() / 1e6 << " MB: per-character << " << perCharacterTime << " ms, bulk << " << bulkTime
+		<< " ms, getline " << getlineTime << " ms (" << count << " lines), >> " << wordTime << " ms (" << wordCount << " words)" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_mapped_load) {
+	auto path = std::filesystem::temp_directory_path() / "my_std_mapped_load.log";
+	{
+		std::ofstream out(path, std::ios::binary);
+		out << my_std::universalStrign<char>("2024-05-01T12:00:00 INFO request served\n") * 2000000;
+	}
+	std::size_t readLines = 0;
+	std::size_t mappedLines = 0;
+	double readTime = measure_ms([&] {
+		std::ifstream in(path, std::ios::binary);
+		auto text = my_std::universalStrign<char>();
+		while (text.append_from(in, 1 << 20)) {
+		}
+		readLines = text.count('\n');
+	});
+	std::size_t before = allocations;
+	double mappedTime = measure_ms([&] {
+		auto text = my_std::make_mapped_string<char>(path.string().c_str());
+		mappedLines = text.count('\n');
+	});
+	std::size_t mappedAllocations = allocations - before;
+	std::filesystem::remove(path);
+	EXPECT_EQ(readLines, mappedLines);
+	std::cout << "80 MB log, load and count lines: read " << readTime << " ms, mapped " << mappedTime
+		<< " ms (" << mappedAllocations << " allocations)" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_convert_wide_records) {
+	auto ascii = my_std::universalStrign<wchar_t>(L"2024-05-01T12:00:00 INFO user=alice action=login status=ok\n") * 200000;
+	auto mixed = my_std::universalStrign<wchar_t>(L"2024-05-01T12:00:00 INFO user=J\u00FCrgen city=\u041A\u0438\u0457\u0432 status=ok\n") * 200000;
+	for (auto* records : { &ascii, &mixed }) {
+		const auto& wide = *records;
+		my_std::universalStrign<char> perCharacter;
+		my_std::universalStrign<char> utf8;
+		double perCharacterTime = measure_ms([&] {
+			for (std::size_t i = 0; i < wide.size(); i++)
+			{
+				perCharacter.push_back(static_cast<char>(wide[i]));
+			}
+		});
+		double utf8Time = measure_ms([&] { utf8 = my_std::convert<char>(wide); });
+		EXPECT_TRUE(my_std::convert<wchar_t>(utf8) == wide);
+		std::cout << wide.size() / 1e6 << "M wide characters: per-character cast " << perCharacterTime
+			<< " ms, validated UTF-8 " << utf8Time << " ms" << std::endl;
+	}
+}
+
+TEST(universalStrign_benchmark, DISABLED_rope_report) {
+	constexpr std::size_t fragments = 300000;
+	std::vector<my_std::universalStrign<char>> pieces;
+	for (std::size_t i = 0; i < fragments; i++)
+	{
+		pieces.push_back(my_std::universalStrign<char>("<td>") + my_std::universalStrign<char>(std::to_string(i).c_str())
+			+ my_std::universalStrign<char>("</td>"));
+	}
+	my_std::universalStrign<char> concatenated;
+	double concatTime = measure_ms([&] {
+		for (std::size_t i = 0; i < fragments / 10; i++)
+		{
+			concatenated = concatenated + pieces[i];
+		}
+	});
+	my_std::universalStrign<char> appended;
+	double appendTime = measure_ms([&] {
+		for (auto& piece : pieces) {
+			appended.append(piece);
+		}
+	});
+	my_std::universalRope<char> rope;
+	double ropeTime = measure_ms([&] {
+		for (auto& piece : pieces) {
+			rope.append(piece);
+		}
+	});
+	my_std::universalRope<char> doubled;
+	double doubleTime = measure_ms([&] {
+		doubled = rope;
+		for (int i = 0; i < 10; i++)
+		{
+			doubled = doubled + doubled.substr(0, doubled.size() / 2);
+		}
+	});
+	my_std::universalStrign<char> flat;
+	double flattenTime = measure_ms([&] { flat = rope.flatten(); });
+	EXPECT_TRUE(flat == appended);
+	std::cout << fragments << " fragments: operator+ loop over a tenth " << concatTime << " ms, append " << appendTime
+		<< " ms, rope append " << ropeTime << " ms, 10 rope self-concats to " << doubled.size() / 1e6 << " MB "
+		<< doubleTime << " ms, flatten " << flattenTime << " ms" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_dedup_lookups) {
+	constexpr std::size_t distinct = 200000;
+	constexpr std::size_t lookups = 5000000;
+	std::vector<my_std::universalStrign<char>> records;
+	std::mt19937 random(5);
+	for (std::size_t i = 0; i < lookups; i++)
+	{
+		auto key = std::to_string(random() % distinct);
+		records.push_back(my_std::universalStrign<char>(("customer-" + key + "@example.com").c_str()));
+	}
+	std::unordered_set<std::string> viaString;
+	std::size_t stringHits = 0;
+	double stringTime = measure_ms([&] {
+		for (auto& record : records) {
+			my_std::universalStrign_view<char> view = record;
+			stringHits += !viaString.insert(std::string(view.data(), view.size())).second;
+		}
+	});
+	std::unordered_set<my_std::universalStrign<char>, my_std::universalStrign_hash, std::equal_to<>> direct;
+	std::size_t directHits = 0;
+	double directTime = measure_ms([&] {
+		for (auto& record : records) {
+			if (direct.find(my_std::universalStrign_view<char>(record)) != direct.end()) {
+				directHits++;
+			}
+			else {
+				direct.insert(record);
+			}
+		}
+	});
+	std::vector<my_std::universalStrign<char, my_std::HashCachingContainer<char>>> cachedRecords;
+	for (auto& record : records) {
+		cachedRecords.push_back(my_std::universalStrign<char, my_std::HashCachingContainer<char>>(my_std::universalStrign_view<char>(record)));
+	}
+	std::unordered_set<my_std::universalStrign<char, my_std::HashCachingContainer<char>>> cached;
+	std::size_t cachedHits = 0;
+	auto probe = [&] {
+		for (auto& record : cachedRecords) {
+			cachedHits += !cached.insert(record).second;
+		}
+	};
+	probe();
+	cachedHits = 0;
+	double cachedTime = measure_ms(probe);
+	EXPECT_EQ(stringHits, directHits);
+	EXPECT_EQ(cachedHits, lookups);
+	std::cout << lookups / 1e6 << "M lookups over " << direct.size() << " keys: via std::string " << stringTime
+		<< " ms, universalStrign_hash with views " << directTime << " ms, cached-hash keys (second pass) " << cachedTime << " ms" << std::endl;
+}
+
+TEST(universalStrign_benchmark, DISABLED_intern_tags) {
+	constexpr std::size_t records = 2000000;
+	constexpr std::size_t distinct = 3000;
+	std::vector<std::string> names;
+	for (std::size_t i = 0; i < distinct; i++)
+	{
+		names.push_back("event_field_name_" + std::to_string(i));
+	}
+	std::mt19937 random(9);
+	std::vector<std::size_t> picks(records);
+	for (auto& pick : picks) {
+		pick = random() % distinct;
+	}
+	std::size_t before = allocations;
+	std::vector<my_std::universalStrign<char>> copies;
+	copies.reserve(records);
+	double copyTime = measure_ms([&] {
+		for (std::size_t pick : picks) {
+			copies.push_back(my_std::universalStrign<char>(names[pick].c_str()));
+		}
+	});
+	std::size_t copyAllocations = allocations - before;
+	my_std::intern_pool<char> pool;
+	before = allocations;
+	std::vector<my_std::interned_strign<char>> handles;
+	handles.reserve(records);
+	double internTime = measure_ms([&] {
+		for (std::size_t pick : picks) {
+			handles.push_back(pool.intern(names[pick].c_str()));
+		}
+	});
+	std::size_t internAllocations = allocations - before;
+	std::size_t copyMatches = 0;
+	std::size_t handleMatches = 0;
+	double copyCompare = measure_ms([&] {
+		for (std::size_t i = 1; i < records; i++)
+		{
+			copyMatches += copies[i] == copies[i - 1];
+		}
+	});
+	double handleCompare = measure_ms([&] {
+		for (std::size_t i = 1; i < records; i++)
+		{
+			handleMatches += handles[i] == handles[i - 1];
+		}
+	});
+	EXPECT_EQ(copyMatches, handleMatches);
+	EXPECT_EQ(pool.size(), distinct);
+	std::cout << records / 1e6 << "M tags of " << distinct << " values: copies " << copyTime << " ms, " << copyAllocations
+		<< " allocations, " << sizeof(my_std::universalStrign<char>) << " bytes each; interned " << internTime << " ms, "
+		<< internAllocations << " allocations, " << sizeof(my_std::interned_strign<char>) << " bytes each; compare "
+		<< copyCompare << " vs " << handleCompare << " ms" << std::endl;
+}
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include "myForwardList.h"
+
+namespace my_std {
+
+    // Lock-free singly linked stack (Treiber style) for many producers and consumers.
+    // Popped nodes are reclaimed through hazard pointers: a node is freed only once no
+    // thread has it published as the node it is about to unlink.
+    template<class T>
+    class concurrent_forward_list {
+    public:
+        using value_type = T;
+
+    private:
+        struct Node {
+            value_type data;
+            Node* next;
+            Node* retired_next;
+
+            template<class... Args>
+            explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), retired_next(nullptr) {}
+        };
+
+        struct HazardRecord {
+            std::atomic<Node*> pointer{ nullptr };
+            std::atomic<bool> active{ true };
+            HazardRecord* next = nullptr;
+        };
+
+        std::atomic<Node*> root;
+        std::atomic<HazardRecord*> hazards;
+        std::atomic<Node*> retired;
+        std::atomic<std::size_t> retired_count;
+
+        static constexpr std::size_t retire_threshold = 64;
+
+    public:
+        concurrent_forward_list() : root(nullptr), hazards(nullptr), retired(nullptr), retired_count(0) {}
+
+        concurrent_forward_list(const concurrent_forward_list&) = delete;
+
+        concurrent_forward_list& operator=(const concurrent_forward_list&) = delete;
+
+        // Not safe to run concurrently with any other member.
+        ~concurrent_forward_list();
+
+        void push_front(const value_type& item) { emplace_front(item); }
+
+        void push_front(value_type&& item) { emplace_front(std::move(item)); }
+
+        template<class... Args>
+        void emplace_front(Args&&...);
+
+        std::optional<value_type> pop_front();
+
+        // Detaches the whole chain with one atomic exchange and returns its elements in
+        // front-to-back order.
+        forward_list<value_type> take_all();
+
+        bool empty() const { return root.load(std::memory_order_acquire) == nullptr; }
+
+    private:
+        HazardRecord* acquire_record();
+
+        void retire_chain(Node* first, Node* last, std::size_t count);
+
+        void scan();
+    };
+
+    template<class T>
+    concurrent_forward_list<T>::~concurrent_forward_list()
+    {
+        for (Node* temp = root.load(std::memory_order_relaxed); temp != nullptr;) {
+            Node* next = temp->next;
+            delete temp;
+            temp = next;
+        }
+        for (Node* temp = retired.load(std::memory_order_relaxed); temp != nullptr;) {
+            Node* next = temp->retired_next;
+            delete temp;
+            temp = next;
+        }
+        for (HazardRecord* record = hazards.load(std::memory_order_relaxed); record != nullptr;) {
+            HazardRecord* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    template<class T>
+    template<class... Args>
+    void concurrent_forward_list<T>::emplace_front(Args&&... args)
+    {
+        Node* created = new Node(std::forward<Args>(args)...);
+        created->next = root.load(std::memory_order_relaxed);
+        while (!root.compare_exchange_weak(created->next, created, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    template<class T>
+    std::optional<T> concurrent_forward_list<T>::pop_front()
+    {
+        HazardRecord* record = acquire_record();
+        Node* top = root.load(std::memory_order_acquire);
+        while (top) {
+            // Publish the hazard, then make sure top is still reachable before reading it. The
+            // fence orders the store before the reload (StoreLoad), which scan() pairs with its
+            // own fence: either scan() sees this hazard, or this reload sees top unlinked.
+            record->pointer.store(top, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            Node* current = root.load(std::memory_order_seq_cst);
+            if (current != top) {
+                top = current;
+                continue;
+            }
+            if (root.compare_exchange_strong(top, top->next, std::memory_order_seq_cst, std::memory_order_acquire)) {
+                break;
+            }
+        }
+        record->pointer.store(nullptr, std::memory_order_release);
+        record->active.store(false, std::memory_order_release);
+        if (!top) {
+            return std::nullopt;
+        }
+        std::optional<value_type> result(std::move(top->data));
+        retire_chain(top, top, 1);
+        return result;
+    }
+
+    template<class T>
+    forward_list<T> concurrent_forward_list<T>::take_all()
+    {
+        auto resultList = forward_list<value_type>();
+        Node* first = root.exchange(nullptr, std::memory_order_seq_cst);
+        if (!first) {
+            return resultList;
+        }
+        // Other poppers may still hold a hazard on these nodes, so they are retired rather
+        // than freed; the elements themselves are exclusively ours after the exchange.
+        Node* last = first;
+        std::size_t count = 0;
+        for (Node* temp = first; temp != nullptr; temp = temp->next) {
+            resultList.push_back(std::move(temp->data));
+            temp->retired_next = temp->next;
+            last = temp;
+            ++count;
+        }
+        retire_chain(first, last, count);
+        return resultList;
+    }
+
+    template<class T>
+    typename concurrent_forward_list<T>::HazardRecord* concurrent_forward_list<T>::acquire_record()
+    {
+        for (HazardRecord* record = hazards.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            bool expected = false;
+            if (!record->active.load(std::memory_order_relaxed)
+                && record->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return record;
+            }
+        }
+        HazardRecord* created = new HazardRecord;
+        created->next = hazards.load(std::memory_order_relaxed);
+        while (!hazards.compare_exchange_weak(created->next, created, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return created;
+    }
+
+    template<class T>
+    void concurrent_forward_list<T>::retire_chain(Node* first, Node* last, std::size_t count)
+    {
+        last->retired_next = retired.load(std::memory_order_relaxed);
+        while (!retired.compare_exchange_weak(last->retired_next, first, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        if (retired_count.fetch_add(count, std::memory_order_relaxed) + count >= retire_threshold) {
+            scan();
+        }
+    }
+
+    template<class T>
+    void concurrent_forward_list<T>::scan()
+    {
+        // Orders the unlinks and retires before the hazard loads below; without it a weakly
+        // ordered machine may read a slot from before a popper published it and free that
+        // popper's node.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Node* candidates = retired.exchange(nullptr, std::memory_order_acq_rel);
+        if (!candidates) {
+            return;
+        }
+        std::vector<Node*> protected_nodes;
+        for (HazardRecord* record = hazards.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+            if (Node* hazard = record->pointer.load(std::memory_order_seq_cst)) {
+                protected_nodes.push_back(hazard);
+            }
+        }
+        std::sort(protected_nodes.begin(), protected_nodes.end());
+
+        Node* kept_first = nullptr;
+        Node* kept_last = nullptr;
+        std::size_t freed = 0;
+        while (candidates) {
+            Node* next = candidates->retired_next;
+            if (std::binary_search(protected_nodes.begin(), protected_nodes.end(), candidates)) {
+                candidates->retired_next = kept_first;
+                kept_first = candidates;
+                if (!kept_last) {
+                    kept_last = candidates;
+                }
+            }
+            else {
+                delete candidates;
+                ++freed;
+            }
+            candidates = next;
+        }
+        retired_count.fetch_sub(freed, std::memory_order_relaxed);
+        if (kept_first) {
+            kept_last->retired_next = retired.load(std::memory_order_relaxed);
+            while (!retired.compare_exchange_weak(kept_last->retired_next, kept_first, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+}
@@ -3,47 +3,283 @@
 #include <utility>
 #include <memory>
 #include <exception>
+#include <stdexcept>
 #include <iostream>
 #include <functional>
+#include <new>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+#include <vector>
+#include <future>
+#include <algorithm>
+#include "threadPool.h"
 
 namespace my_std {
 
-    template<class value_type>
+    enum class split_mode { copy, cut };
+
+    // Slab allocator for fixed-size nodes: slots are carved out of chunks and recycled
+    // through an intrusive free list. Chunks start at first_chunk slots and double up to
+    // ChunkSize, so a short list costs one small allocation, which also holds the pool's
+    // bookkeeping. Every copy is a fresh, empty pool, so each container owns its own slabs;
+    // share() is the one way to get a second handle on the same slabs. Handles sharing slabs
+    // must be used from one thread at a time.
+    template<class T, std::size_t ChunkSize = 256>
+    class node_pool {
+        union Slot {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        // Header of a chunk; its slots follow it in the same block.
+        struct Chunk {
+            Chunk* next;
+        };
+
+        // Lives in the first (home) chunk it allocates, right after that chunk's header, and
+        // is freed with it. Pools taken over by adopt() are kept on a flat list and freed
+        // together with this one.
+        struct Arena {
+            Chunk* chunks = nullptr;
+            Slot* free_slots = nullptr;
+            Arena* adopted = nullptr;
+            std::size_t owners = 1;
+            std::size_t next_capacity = 0;
+        };
+
+        static constexpr std::size_t first_chunk = ChunkSize < 8 ? ChunkSize : 8;
+
+        static constexpr std::size_t round_up(std::size_t value, std::size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        static constexpr std::size_t arena_offset = round_up(sizeof(Chunk), alignof(Arena));
+        static constexpr std::size_t home_slots_offset = round_up(arena_offset + sizeof(Arena), alignof(Slot));
+        static constexpr std::size_t slots_offset = round_up(sizeof(Chunk), alignof(Slot));
+        static constexpr std::size_t chunk_alignment = std::max({ alignof(Chunk), alignof(Arena), alignof(Slot) });
+
+        Arena* arena;
+
+        explicit node_pool(Arena* Shared) noexcept : arena(Shared) {}
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        template<class U>
+        struct rebind { using other = node_pool<U, ChunkSize>; };
+
+        node_pool() noexcept : arena(nullptr) {}
+
+        node_pool(const node_pool&) noexcept : node_pool() {}
+
+        template<class U>
+        node_pool(const node_pool<U, ChunkSize>&) noexcept : node_pool() {}
+
+        node_pool(node_pool&& other) noexcept : arena(other.arena) { other.arena = nullptr; }
+
+        ~node_pool() { detach(); }
+
+        node_pool& operator=(const node_pool&) noexcept { return *this; }
+
+        node_pool& operator=(node_pool&& other) noexcept {
+            if (this != &other) {
+                detach();
+                std::swap(arena, other.arena);
+            }
+            return *this;
+        }
+
+        node_pool select_on_container_copy_construction() const noexcept { return node_pool(); }
+
+        // Second handle on the same slabs: objects allocated through either handle may be
+        // deallocated through the other, and the slabs live until the last handle is gone.
+        node_pool share() {
+            if (!arena) {
+                grow();
+            }
+            ++arena->owners;
+            return node_pool(arena);
+        }
+
+        bool exclusive() const noexcept { return !arena || arena->owners == 1; }
+
+        T* allocate(std::size_t count) {
+            if (count != 1) {
+                return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ alignof(T) }));
+            }
+            if (!arena || !arena->free_slots) {
+                grow();
+            }
+            Slot* slot = arena->free_slots;
+            arena->free_slots = slot->next;
+            return reinterpret_cast<T*>(slot->storage);
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept {
+            if (count != 1) {
+                ::operator delete(pointer, std::align_val_t{ alignof(T) });
+                return;
+            }
+            Slot* slot = reinterpret_cast<Slot*>(pointer);
+            slot->next = arena->free_slots;
+            arena->free_slots = slot;
+        }
+
+        // Hands every chunk back to the system at once. Objects still living in the pool
+        // must already be destroyed; a shared pool keeps its chunks for the other handles.
+        void release() noexcept {
+            if (!exclusive()) {
+                return;
+            }
+            free_arena(arena);
+            arena = nullptr;
+        }
+
+        // Takes over every chunk of an exclusive pool, so objects allocated there may now be
+        // deallocated or released through this pool; other is left a fresh, empty pool. Free
+        // slots of other are kept only when this pool has none; otherwise they stay idle
+        // until release().
+        void adopt(node_pool& other) {
+            if (arena == other.arena || !other.arena || !other.arena->chunks || !other.exclusive()) {
+                return;
+            }
+            Arena* taken = std::exchange(other.arena, nullptr);
+            if (!arena) {
+                arena = taken;
+                return;
+            }
+            if (!arena->free_slots) {
+                arena->free_slots = std::exchange(taken->free_slots, nullptr);
+            }
+            Arena* last = taken;
+            while (last->adopted) {
+                last = last->adopted;
+            }
+            last->adopted = arena->adopted;
+            arena->adopted = taken;
+        }
+
+        friend bool operator==(const node_pool& left, const node_pool& right) noexcept {
+            return &left == &right || (left.arena && left.arena == right.arena);
+        }
+
+        friend bool operator!=(const node_pool& left, const node_pool& right) noexcept { return !(left == right); }
+
+    private:
+        static void* allocate_block(std::size_t bytes) {
+            if constexpr (chunk_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return ::operator new(bytes, std::align_val_t{ chunk_alignment });
+            }
+            else {
+                return ::operator new(bytes);
+            }
+        }
+
+        static void free_block(void* block) noexcept {
+            if constexpr (chunk_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                ::operator delete(block, std::align_val_t{ chunk_alignment });
+            }
+            else {
+                ::operator delete(block);
+            }
+        }
+
+        void grow() {
+            std::size_t capacity = arena ? arena->next_capacity : first_chunk;
+            std::size_t offset = arena ? slots_offset : home_slots_offset;
+            auto* block = static_cast<unsigned char*>(allocate_block(offset + capacity * sizeof(Slot)));
+            Chunk* chunk = ::new (static_cast<void*>(block)) Chunk{ nullptr };
+            if (!arena) {
+                arena = ::new (static_cast<void*>(block + arena_offset)) Arena;
+            }
+            chunk->next = arena->chunks;
+            arena->chunks = chunk;
+            arena->next_capacity = std::min(capacity * 2, ChunkSize);
+            Slot* slots = reinterpret_cast<Slot*>(block + offset);
+            for (std::size_t i = capacity; i > 0; --i) {
+                slots[i - 1].next = arena->free_slots;
+                arena->free_slots = &slots[i - 1];
+            }
+        }
+
+        // Frees the chunks of item and of every pool it adopted. Each arena sits in its own
+        // oldest chunk, the last one on its list, so nothing is read after that one goes.
+        static void free_arena(Arena* item) noexcept {
+            while (item) {
+                Arena* next = item->adopted;
+                for (Chunk* chunk = item->chunks; chunk != nullptr;) {
+                    Chunk* following = chunk->next;
+                    free_block(chunk);
+                    chunk = following;
+                }
+                item = next;
+            }
+        }
+
+        void detach() noexcept {
+            if (arena && --arena->owners == 0) {
+                free_arena(arena);
+            }
+            arena = nullptr;
+        }
+    };
+
+    template<class T, class Allocator = node_pool<T>>
     class forward_list {
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+    private:
         struct Node;
-        using node = std::shared_ptr<Node>;
-        using weak_node = std::weak_ptr<Node>;
+        struct NodeBase;
+        using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+        using node = Node*;
         std::size_t Size;
-        node root;
+        NodeBase head;
+        node tail;
+        node_allocator allocator;
     public:
 
-        forward_list() : Size(0), root(nullptr) {}
+        forward_list() : Size(0), head{ nullptr }, tail(nullptr), allocator() {}
 
         explicit forward_list(std::size_t);
 
         forward_list(std::initializer_list<value_type>);
 
-        forward_list(forward_list&) = default;
+        forward_list(const forward_list&);
 
         forward_list(forward_list&&) noexcept;
 
         ~forward_list() { clear(); }
 
-        forward_list& operator=(forward_list&) = default;
+        forward_list& operator=(const forward_list&);
 
         forward_list& operator=(forward_list&&) noexcept;
 
         std::size_t size() const { return Size; }
 
-        void push_front(value_type&);
+        void push_front(const value_type&);
 
         void push_front(value_type&&);
 
-        void push_back(value_type&);
+        void push_back(const value_type&);
 
         void push_back(value_type&&);
 
-        void insert(value_type&, int);
+        template<class... Args>
+        value_type& emplace_front(Args&&...);
+
+        template<class... Args>
+        value_type& emplace_back(Args&&...);
+
+        void insert(const value_type&, int);
 
         void insert(value_type&&, int);
 
@@ -55,122 +291,373 @@ namespace my_std {
 
         void clear();
 
-        bool empty() { return (root) ? false : true; }
+        bool empty() const { return (head.next) ? false : true; }
 
         value_type& operator[](int);
 
         value_type operator[](int) const;
 
-        forward_list<value_type> split_when(std::function<bool(value_type)> SplitPredicate);
+        // Returns the elements from the first one matching SplitPredicate to the end. In copy
+        // mode the list is left untouched; in cut mode the matching tail is unlinked and
+        // handed over without copying.
+        template<class Predicate>
+        forward_list<value_type, Allocator> split_when(Predicate&& SplitPredicate, split_mode mode = split_mode::copy);
+
+        // Stable bottom-up merge sort; nodes are relinked, never copied or reallocated.
+        template<class Compare = std::less<>>
+        void sort(Compare comp = Compare());
+
+        // Merges the sorted other into this sorted list, leaving other empty.
+        template<class Compare = std::less<>>
+        void merge(forward_list& other, Compare comp = Compare());
+
+        void reverse() noexcept;
+
+        template<class BinaryPredicate = std::equal_to<>>
+        std::size_t unique(BinaryPredicate equal = BinaryPredicate());
+
+        template<class Predicate>
+        std::size_t remove_if(Predicate predicate);
+
+        // Cuts the chain into one segment per pool thread (each at least MinSegment nodes)
+        // and runs them concurrently, the calling thread taking the first. Short lists run
+        // serially. function is shared by all segments, so it must be safe to call in parallel.
+        template<class Function>
+        void parallel_for_each(Function function, thread_pool& pool = thread_pool::shared(), std::size_t MinSegment = 4096);
+
+        // Reduces segments independently and folds them left to right onto init, so reduce
+        // must be associative but need not be commutative.
+        template<class Result, class Reduce, class Transform>
+        Result parallel_transform_reduce(Result init, Reduce reduce, Transform transform,
+            thread_pool& pool = thread_pool::shared(), std::size_t MinSegment = 4096) const;
+
+        class const_iterator;
 
         class iterator {
-        protected:
-            node pointer;
+            friend class forward_list;
+            friend class const_iterator;
+            NodeBase* current;
         public:
-            iterator() = default;
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            iterator() noexcept : current(nullptr) {}
+
+            explicit iterator(NodeBase* right_side_hand) noexcept : current(right_side_hand) {}
+
+            reference operator*() const { return static_cast<node>(current)->data; }
 
-            iterator(node right_side_hand) : pointer(right_side_hand) {}
+            pointer operator->() const { return &static_cast<node>(current)->data; }
 
-            iterator operator++() {
-                pointer = pointer->next;
+            iterator& operator++() {
+                current = current->next;
                 return *this;
             }
 
-            bool operator!=(iterator right_side_hand) { return right_side_hand.pointer != pointer; }
+            iterator operator++(int) {
+                iterator previous = *this;
+                current = current->next;
+                return previous;
+            }
 
-            int& operator*() { return pointer->data; }
+            bool operator==(const iterator& right_side_hand) const { return current == right_side_hand.current; }
 
-            ~iterator() { pointer.reset(); }
+            bool operator!=(const iterator& right_side_hand) const { return current != right_side_hand.current; }
         };
 
-        class const_iterator : public iterator {
+        class const_iterator {
+            friend class forward_list;
+            const NodeBase* current;
         public:
-            const_iterator() = default;
-            const_iterator(node right_side_hand) : iterator(right_side_hand) { }
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() noexcept : current(nullptr) {}
+
+            explicit const_iterator(const NodeBase* right_side_hand) noexcept : current(right_side_hand) {}
+
+            const_iterator(const iterator& other) noexcept : current(other.current) {}
+
+            reference operator*() const { return static_cast<const Node*>(current)->data; }
+
+            pointer operator->() const { return &static_cast<const Node*>(current)->data; }
+
+            const_iterator& operator++() {
+                current = current->next;
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator previous = *this;
+                current = current->next;
+                return previous;
+            }
+
+            bool operator==(const const_iterator& right_side_hand) const { return current == right_side_hand.current; }
 
-            int operator*() { return pointer->data; }
+            bool operator!=(const const_iterator& right_side_hand) const { return current != right_side_hand.current; }
         };
 
-        iterator begin() { return iterator{ root }; }
+        iterator before_begin() { return iterator{ &head }; }
+
+        iterator begin() { return iterator{ head.next }; }
 
         iterator end() { return iterator{}; }
 
-        const_iterator begin() const { return const_iterator{ root }; }
+        const_iterator before_begin() const { return const_iterator{ &head }; }
+
+        const_iterator begin() const { return const_iterator{ head.next }; }
 
         const_iterator end() const { return const_iterator{}; }
 
+        const_iterator cbefore_begin() const { return const_iterator{ &head }; }
+
+        const_iterator cbegin() const { return const_iterator{ head.next }; }
+
+        const_iterator cend() const { return const_iterator{}; }
+
+        iterator insert_after(const_iterator, const value_type&);
+
+        iterator insert_after(const_iterator, value_type&&);
+
+        template<class... Args>
+        iterator emplace_after(const_iterator, Args&&...);
+
+        iterator erase_after(const_iterator);
+
+        iterator erase_after(const_iterator, const_iterator);
+
+        void splice_after(const_iterator, forward_list&);
+
+        void splice_after(const_iterator, forward_list&, const_iterator, const_iterator);
+
     private:
 
-        struct Node {
-            value_type data;
+        struct NodeBase {
             node next;
+        };
 
-            explicit Node(value_type& Data = value_type(), node nextNode = nullptr) : data(Data), next(nextNode) {}
+        struct Node : NodeBase {
+            value_type data;
 
-            explicit Node(value_type&& Data = value_type(), node nextNode = nullptr) : data(std::move(Data)), next(nextNode) {}
+            template<class... Args>
+            explicit Node(node nextNode, Args&&... args) : NodeBase{ nextNode }, data(std::forward<Args>(args)...) {}
         };
 
+        template<class... Args>
+        node create_node(Args&&... args) {
+            node created = node_traits::allocate(allocator, 1);
+            try {
+                node_traits::construct(allocator, created, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                node_traits::deallocate(allocator, created, 1);
+                throw;
+            }
+            return created;
+        }
+
+        void destroy_node(node to_delete) noexcept {
+            node_traits::destroy(allocator, to_delete);
+            node_traits::deallocate(allocator, to_delete, 1);
+        }
+
+        // Nodes can change owners without copying when both allocators can free each other's
+        // nodes, or when the destination can take over the source pool wholesale.
+        bool can_steal_nodes(forward_list& other) {
+            if (allocator == other.allocator) {
+                return true;
+            }
+            if constexpr (requires(node_allocator& pool) { pool.adopt(pool); pool.exclusive(); }) {
+                return other.allocator.exclusive();
+            }
+            else {
+                return false;
+            }
+        }
+
+        // Allocator for a list that will receive nodes cut out of this one.
+        node_allocator share_allocator() {
+            if constexpr (requires(node_allocator& pool) { pool.share(); }) {
+                return allocator.share();
+            }
+            else {
+                return allocator;
+            }
+        }
+
+        explicit forward_list(node_allocator&& Shared) : Size(0), head{ nullptr }, tail(nullptr), allocator(std::move(Shared)) {}
+
+        template<class Compare>
+        static node merge_chains(node first, node second, Compare& comp) {
+            NodeBase merged{ nullptr };
+            NodeBase* last = &merged;
+            while (first && second) {
+                if (comp(second->data, first->data)) {
+                    last->next = second;
+                    second = second->next;
+                }
+                else {
+                    last->next = first;
+                    first = first->next;
+                }
+                last = last->next;
+            }
+            last->next = first ? first : second;
+            return merged.next;
+        }
+
+        void reset_tail() noexcept {
+            tail = head.next;
+            while (tail && tail->next) {
+                tail = tail->next;
+            }
+        }
+
+        std::vector<std::pair<node, std::size_t>> segments(std::size_t parts) const {
+            std::vector<std::pair<node, std::size_t>> result;
+            std::size_t length = Size / parts;
+            std::size_t extra = Size % parts;
+            node temp = head.next;
+            for (std::size_t i = 0; i < parts; ++i) {
+                std::size_t count = length + (i < extra ? 1 : 0);
+                result.emplace_back(temp, count);
+                for (std::size_t j = 0; j < count; ++j) {
+                    temp = temp->next;
+                }
+            }
+            return result;
+        }
+
+        std::size_t segment_count(const thread_pool& pool, std::size_t MinSegment) const {
+            return std::min(pool.size(), Size / std::max<std::size_t>(MinSegment, 1));
+        }
+
         node getNodeByIndex(std::size_t index) const {
-            node temp = root;
-            for (int i = 0; i < index; ++i) {
+            node temp = head.next;
+            for (std::size_t i = 0; i < index; ++i) {
                 temp = temp->next;
             }
             return temp;
         }
     };
 
-    template<class value_type>
-    forward_list<value_type>::forward_list(std::initializer_list<value_type> list) : forward_list<value_type>() {
-        for (value_type item : list) {
-            forward_list<value_type>::push_back(item);
+    template<class value_type, class Allocator>
+    forward_list<value_type, Allocator>::forward_list(std::initializer_list<value_type> list) : forward_list<value_type, Allocator>() {
+        for (const value_type& item : list) {
+            forward_list<value_type, Allocator>::emplace_back(item);
         }
     }
 
-    template<class value_type>
-    forward_list<value_type>::forward_list(forward_list&& other) noexcept : Size(other.Size), root(other.root) {
+    template<class value_type, class Allocator>
+    forward_list<value_type, Allocator>::forward_list(const forward_list& other)
+        : Size(0), head{ nullptr }, tail(nullptr), allocator(node_traits::select_on_container_copy_construction(other.allocator)) {
+        for (node temp = other.head.next; temp != nullptr; temp = temp->next) {
+            push_back(temp->data);
+        }
+    }
+
+    template<class value_type, class Allocator>
+    forward_list<value_type, Allocator>::forward_list(forward_list&& other) noexcept
+        : Size(other.Size), head{ other.head.next }, tail(other.tail), allocator(std::move(other.allocator)) {
         other.Size = 0;
-        other.root.reset();
+        other.head.next = nullptr;
+        other.tail = nullptr;
+    }
+
+    template<class value_type, class Allocator>
+    forward_list<value_type, Allocator>& forward_list<value_type, Allocator>::operator=(const forward_list<value_type, Allocator>& other)
+    {
+        if (this != &other) {
+            clear();
+            for (node temp = other.head.next; temp != nullptr; temp = temp->next) {
+                push_back(temp->data);
+            }
+        }
+        return *this;
     }
 
-    template<class value_type>
-    forward_list<value_type>& forward_list<value_type>::operator=(forward_list<value_type>&& other) noexcept
+    template<class value_type, class Allocator>
+    forward_list<value_type, Allocator>& forward_list<value_type, Allocator>::operator=(forward_list<value_type, Allocator>&& other) noexcept
     {
+        if (this == &other) {
+            return *this;
+        }
         clear();
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+        }
+        else if (allocator != other.allocator) {
+            // Nodes cannot change owners between unequal allocators, so move element by element.
+            for (node temp = other.head.next; temp != nullptr; temp = temp->next) {
+                push_back(std::move(temp->data));
+            }
+            other.clear();
+            return *this;
+        }
         Size = other.Size;
-        root = other.root;
+        head.next = other.head.next;
+        tail = other.tail;
         other.Size = 0;
-        other.root.reset();
+        other.head.next = nullptr;
+        other.tail = nullptr;
         return *this;
     }
 
-    template<class value_type>
-    void forward_list<value_type>::push_front(value_type& item)
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::push_front(const value_type& item)
     {
-        root.reset(new Node(item, root));
-        Size++;
+        emplace_front(item);
+    }
+
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::push_front(value_type&& item)
+    {
+        emplace_front(std::move(item));
+    }
+
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::push_back(value_type&& item) {
+        emplace_back(std::move(item));
     }
 
-    template<class value_type>
-    void forward_list<value_type>::push_front(value_type&& item)
+    template<class value_type, class Allocator>
+    template<class... Args>
+    value_type& forward_list<value_type, Allocator>::emplace_front(Args&&... args)
     {
-        root.reset(new Node(std::move(item), root));
+        head.next = create_node(head.next, std::forward<Args>(args)...);
+        if (!tail) {
+            tail = head.next;
+        }
         Size++;
+        return head.next->data;
     }
 
-    template<class value_type>
-    void forward_list<value_type>::push_back(value_type&& item) {
-        if (root) {
-            getNodeByIndex(Size - 1)->next.reset(new Node(std::move(item)));
+    template<class value_type, class Allocator>
+    template<class... Args>
+    value_type& forward_list<value_type, Allocator>::emplace_back(Args&&... args)
+    {
+        node created = create_node(nullptr, std::forward<Args>(args)...);
+        if (tail) {
+            tail->next = created;
         }
         else {
-            root.reset(new Node(std::move(item)));
+            head.next = created;
         }
+        tail = created;
         ++Size;
+        return created->data;
     }
 
-    template<class value_type>
-    value_type& forward_list<value_type>::operator[](int index) {
-        if (index < Size) {
+    template<class value_type, class Allocator>
+    value_type& forward_list<value_type, Allocator>::operator[](int index) {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
             return getNodeByIndex(index)->data;
         }
         else {
@@ -178,10 +665,10 @@ namespace my_std {
         }
     }
 
-    template<class value_type>
-    inline value_type forward_list<value_type>::operator[](int index) const
+    template<class value_type, class Allocator>
+    inline value_type forward_list<value_type, Allocator>::operator[](int index) const
     {
-        if (index < Size) {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
             return getNodeByIndex(index)->data;
         }
         else {
@@ -189,91 +676,134 @@ namespace my_std {
         }
     }
 
-    template<class value_type>
-    inline forward_list<value_type> forward_list<value_type>::split_when(std::function<bool(value_type)> SplitPredicate)
+    template<class value_type, class Allocator>
+    template<class Predicate>
+    inline forward_list<value_type, Allocator> forward_list<value_type, Allocator>::split_when(Predicate&& SplitPredicate, split_mode mode)
     {
-        node temp = root;
-        auto resultList = forward_list<value_type>();
-        while (!SplitPredicate(temp->data) && temp->next != nullptr) {
-            temp = temp->next;
+        NodeBase* previous = &head;
+        std::size_t skipped = 0;
+        while (previous->next && !SplitPredicate(std::as_const(previous->next->data))) {
+            previous = previous->next;
+            ++skipped;
         }
-        if (SplitPredicate(temp->data)) {
-            while (temp != nullptr) {
+        if (mode == split_mode::copy) {
+            auto resultList = forward_list<value_type, Allocator>();
+            for (node temp = previous->next; temp != nullptr; temp = temp->next) {
                 resultList.push_back(temp->data);
-                temp = temp->next;
             }
+            return resultList;
+        }
+        auto resultList = forward_list<value_type, Allocator>(share_allocator());
+        if (!previous->next) {
+            return resultList;
+        }
+        if (resultList.allocator != allocator) {
+            for (node temp = previous->next; temp != nullptr; temp = temp->next) {
+                resultList.push_back(std::move(temp->data));
+            }
+            erase_after(const_iterator{ previous }, cend());
+            return resultList;
         }
+        resultList.head.next = previous->next;
+        resultList.tail = tail;
+        resultList.Size = Size - skipped;
+        previous->next = nullptr;
+        tail = (previous == &head) ? nullptr : static_cast<node>(previous);
+        Size = skipped;
         return resultList;
     }
 
-    template<class value_type>
-    void forward_list<value_type>::push_back(value_type& item) {
-        if (root) {
-            getNodeByIndex(Size - 1)->next.reset(new Node((item)));
-        }
-        else {
-            root.reset(new Node((item)));
-        }
-        ++Size;
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::push_back(const value_type& item) {
+        emplace_back(item);
     }
 
-    template<class value_type>
-    void forward_list<value_type>::removeAt(int index)
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::removeAt(int index)
     {
-        if (index < this->Size) {
+        if (index >= 0 && static_cast<std::size_t>(index) < this->Size) {
             if (!index) {
                 pop_front();
             }
             else {
                 node previous_temp = getNodeByIndex(index - 1);
-                weak_node to_delete_temp = previous_temp->next;
-                previous_temp->next = previous_temp->next->next;
-                to_delete_temp.reset();
+                node to_delete_temp = previous_temp->next;
+                previous_temp->next = to_delete_temp->next;
+                if (to_delete_temp == tail) {
+                    tail = previous_temp;
+                }
+                destroy_node(to_delete_temp);
                 --Size;
             }
         }
     }
 
-    template<class value_type>
-    forward_list<value_type>::forward_list(std::size_t size) : forward_list<value_type>() {
-        for (int i = 0; i < size; ++i) {
-            forward_list<value_type>::push_back(0);
+    template<class value_type, class Allocator>
+    forward_list<value_type, Allocator>::forward_list(std::size_t size) : forward_list<value_type, Allocator>() {
+        for (std::size_t i = 0; i < size; ++i) {
+            forward_list<value_type, Allocator>::emplace_back();
         }
     }
 
-    template<class value_type>
-    void forward_list<value_type>::pop_front() {
-        if (root) {
-            weak_node temp = root;
-            root = root->next;
-            temp.reset();
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::pop_front() {
+        if (head.next) {
+            node temp = head.next;
+            head.next = temp->next;
+            if (!head.next) {
+                tail = nullptr;
+            }
+            destroy_node(temp);
             --Size;
         }
     }
 
-    template<class value_type>
-    void forward_list<value_type>::clear() {
-        while (Size) {
-            pop_front();
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::clear() {
+        // Walks the chain once instead of relinking the head per node. A pool that owns only
+        // this list's nodes gets its chunks back in one go rather than slot by slot.
+        constexpr bool releasable = requires(node_allocator& pool) { pool.release(); pool.exclusive(); };
+        bool bulk = false;
+        if constexpr (releasable) {
+            bulk = allocator.exclusive();
+        }
+        node temp = head.next;
+        while (temp) {
+            node next = temp->next;
+            if (!bulk) {
+                destroy_node(temp);
+            }
+            else if constexpr (!std::is_trivially_destructible_v<Node>) {
+                node_traits::destroy(allocator, temp);
+            }
+            temp = next;
+        }
+        if constexpr (releasable) {
+            if (bulk) {
+                allocator.release();
+            }
         }
+        head.next = nullptr;
+        tail = nullptr;
+        Size = 0;
     }
 
-    template<class value_type>
-    void forward_list<value_type>::pop_back() {
-        if (root) {
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::pop_back() {
+        if (head.next) {
             removeAt(Size - 1);
         }
     }
 
-    template<class value_type>
-    void forward_list<value_type>::insert(value_type& item, int index) {
-        if (index < Size) {
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::insert(const value_type& item, int index) {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
             if (!index) {
                 push_front(item);
             }
             else {
                 node temp_previous = getNodeByIndex(index - 1);
-                temp_previous->next.reset(new Node(item, temp_previous->next));
+                temp_previous->next = create_node(temp_previous->next, item);
                 Size++;
             }
         }
@@ -282,16 +812,16 @@ namespace my_std {
         }
     }
 
-    template<class value_type>
-    void forward_list<value_type>::insert(value_type&& item, int index)
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::insert(value_type&& item, int index)
     {
-        if (index < Size) {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
             if (!index) {
                 push_front(std::move(item));
             }
             else {
                 node temp_previous = getNodeByIndex(index - 1);
-                temp_previous->next.reset(new Node(std::move(item), temp_previous->next));
+                temp_previous->next = create_node(temp_previous->next, std::move(item));
                 Size++;
             }
         }
@@ -300,5 +830,914 @@ namespace my_std {
         }
     }
 
-}
+    template<class value_type, class Allocator>
+    typename forward_list<value_type, Allocator>::iterator forward_list<value_type, Allocator>::insert_after(const_iterator position, const value_type& item)
+    {
+        return emplace_after(position, item);
+    }
 
+    template<class value_type, class Allocator>
+    typename forward_list<value_type, Allocator>::iterator forward_list<value_type, Allocator>::insert_after(const_iterator position, value_type&& item)
+    {
+        return emplace_after(position, std::move(item));
+    }
+
+    template<class value_type, class Allocator>
+    template<class... Args>
+    typename forward_list<value_type, Allocator>::iterator forward_list<value_type, Allocator>::emplace_after(const_iterator position, Args&&... args)
+    {
+        NodeBase* previous = const_cast<NodeBase*>(position.current);
+        node created = create_node(previous->next, std::forward<Args>(args)...);
+        previous->next = created;
+        if (!tail || previous == tail) {
+            tail = created;
+        }
+        ++Size;
+        return iterator{ created };
+    }
+
+    template<class value_type, class Allocator>
+    typename forward_list<value_type, Allocator>::iterator forward_list<value_type, Allocator>::erase_after(const_iterator position)
+    {
+        NodeBase* previous = const_cast<NodeBase*>(position.current);
+        node to_delete = previous->next;
+        if (!to_delete) {
+            return end();
+        }
+        previous->next = to_delete->next;
+        if (to_delete == tail) {
+            tail = (previous == &head) ? nullptr : static_cast<node>(previous);
+        }
+        destroy_node(to_delete);
+        --Size;
+        return iterator{ previous->next };
+    }
+
+    template<class value_type, class Allocator>
+    typename forward_list<value_type, Allocator>::iterator forward_list<value_type, Allocator>::erase_after(const_iterator first, const_iterator last)
+    {
+        while (first.current->next != last.current) {
+            erase_after(first);
+        }
+        return iterator{ const_cast<NodeBase*>(last.current) };
+    }
+
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::splice_after(const_iterator position, forward_list& other)
+    {
+        if (this == &other || !other.head.next) {
+            return;
+        }
+        if (!can_steal_nodes(other)) {
+            for (node temp = other.head.next; temp != nullptr; temp = temp->next) {
+                position = emplace_after(position, std::move(temp->data));
+            }
+            other.clear();
+            return;
+        }
+        if constexpr (requires(node_allocator& pool) { pool.adopt(pool); }) {
+            if (allocator != other.allocator) {
+                allocator.adopt(other.allocator);
+            }
+        }
+        NodeBase* previous = const_cast<NodeBase*>(position.current);
+        other.tail->next = previous->next;
+        previous->next = other.head.next;
+        if (!tail || previous == tail) {
+            tail = other.tail;
+        }
+        Size += other.Size;
+        other.head.next = nullptr;
+        other.tail = nullptr;
+        other.Size = 0;
+    }
+
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::splice_after(const_iterator position, forward_list& other, const_iterator first, const_iterator last)
+    {
+        NodeBase* range_before = const_cast<NodeBase*>(first.current);
+        if (range_before->next == last.current) {
+            return;
+        }
+        // A per-list pool cannot hand over just part of its chunks, so a range taken from
+        // another list is relinked only when the allocators are interchangeable.
+        if (this != &other && allocator != other.allocator) {
+            for (node temp = range_before->next; temp != last.current; temp = temp->next) {
+                position = emplace_after(position, std::move(temp->data));
+            }
+            other.erase_after(first, last);
+            return;
+        }
+        node range_first = range_before->next;
+        node range_last = range_first;
+        std::size_t count = 1;
+        while (range_last->next != last.current) {
+            range_last = range_last->next;
+            ++count;
+        }
+        NodeBase* previous = const_cast<NodeBase*>(position.current);
+        range_before->next = range_last->next;
+        if (range_last == other.tail) {
+            other.tail = (range_before == &other.head) ? nullptr : static_cast<node>(range_before);
+        }
+        range_last->next = previous->next;
+        previous->next = range_first;
+        if (!tail || previous == tail) {
+            tail = range_last;
+        }
+        other.Size -= count;
+        Size += count;
+    }
+
+
+    template<class value_type, class Allocator>
+    template<class Compare>
+    void forward_list<value_type, Allocator>::sort(Compare comp)
+    {
+        // bins[i] holds a sorted run of 2^i nodes that precede everything carried after it.
+        node bins[64] = {};
+        node current = head.next;
+        while (current) {
+            node carry = current;
+            current = current->next;
+            carry->next = nullptr;
+            std::size_t i = 0;
+            for (; i < 63 && bins[i]; ++i) {
+                carry = merge_chains(bins[i], carry, comp);
+                bins[i] = nullptr;
+            }
+            bins[i] = bins[i] ? merge_chains(bins[i], carry, comp) : carry;
+        }
+        node result = nullptr;
+        for (std::size_t i = 0; i < 64; ++i) {
+            if (bins[i]) {
+                result = merge_chains(bins[i], result, comp);
+            }
+        }
+        head.next = result;
+        reset_tail();
+    }
+
+    template<class value_type, class Allocator>
+    template<class Compare>
+    void forward_list<value_type, Allocator>::merge(forward_list& other, Compare comp)
+    {
+        if (this == &other || !other.head.next) {
+            return;
+        }
+        if (!head.next) {
+            splice_after(cbefore_begin(), other);
+            return;
+        }
+        node middle = tail;
+        splice_after(const_iterator{ middle }, other);
+        node second = middle->next;
+        middle->next = nullptr;
+        head.next = merge_chains(head.next, second, comp);
+        reset_tail();
+    }
+
+    template<class value_type, class Allocator>
+    void forward_list<value_type, Allocator>::reverse() noexcept
+    {
+        node previous = nullptr;
+        node current = head.next;
+        tail = current;
+        while (current) {
+            node next = current->next;
+            current->next = previous;
+            previous = current;
+            current = next;
+        }
+        head.next = previous;
+    }
+
+    template<class value_type, class Allocator>
+    template<class BinaryPredicate>
+    std::size_t forward_list<value_type, Allocator>::unique(BinaryPredicate equal)
+    {
+        std::size_t removed = 0;
+        node current = head.next;
+        while (current && current->next) {
+            if (equal(std::as_const(current->data), std::as_const(current->next->data))) {
+                erase_after(const_iterator{ current });
+                ++removed;
+            }
+            else {
+                current = current->next;
+            }
+        }
+        return removed;
+    }
+
+    template<class value_type, class Allocator>
+    template<class Predicate>
+    std::size_t forward_list<value_type, Allocator>::remove_if(Predicate predicate)
+    {
+        std::size_t removed = 0;
+        NodeBase* previous = &head;
+        while (previous->next) {
+            if (predicate(std::as_const(previous->next->data))) {
+                erase_after(const_iterator{ previous });
+                ++removed;
+            }
+            else {
+                previous = previous->next;
+            }
+        }
+        return removed;
+    }
+
+    template<class value_type, class Allocator>
+    template<class Function>
+    void forward_list<value_type, Allocator>::parallel_for_each(Function function, thread_pool& pool, std::size_t MinSegment)
+    {
+        std::size_t parts = segment_count(pool, MinSegment);
+        if (parts < 2) {
+            for (node temp = head.next; temp != nullptr; temp = temp->next) {
+                function(temp->data);
+            }
+            return;
+        }
+        auto run = [&function](node temp, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i, temp = temp->next) {
+                function(temp->data);
+            }
+        };
+        auto pieces = segments(parts);
+        std::vector<std::future<void>> pending;
+        for (std::size_t i = 1; i < pieces.size(); ++i) {
+            pending.push_back(pool.submit([&run, piece = pieces[i]] { run(piece.first, piece.second); }));
+        }
+        std::exception_ptr failure;
+        try {
+            run(pieces[0].first, pieces[0].second);
+        }
+        catch (...) {
+            failure = std::current_exception();
+        }
+        for (auto& piece : pending) {
+            piece.wait();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        for (auto& piece : pending) {
+            piece.get();
+        }
+    }
+
+    template<class value_type, class Allocator>
+    template<class Result, class Reduce, class Transform>
+    Result forward_list<value_type, Allocator>::parallel_transform_reduce(Result init, Reduce reduce, Transform transform,
+        thread_pool& pool, std::size_t MinSegment) const
+    {
+        auto run = [&reduce, &transform](node temp, std::size_t count) {
+            Result local = transform(std::as_const(temp->data));
+            for (std::size_t i = 1; i < count; ++i) {
+                temp = temp->next;
+                local = reduce(std::move(local), transform(std::as_const(temp->data)));
+            }
+            return local;
+        };
+        std::size_t parts = segment_count(pool, MinSegment);
+        if (parts < 2) {
+            return Size ? reduce(std::move(init), run(head.next, Size)) : init;
+        }
+        auto pieces = segments(parts);
+        std::vector<std::future<Result>> pending;
+        for (std::size_t i = 1; i < pieces.size(); ++i) {
+            pending.push_back(pool.submit([&run, piece = pieces[i]] { return run(piece.first, piece.second); }));
+        }
+        std::exception_ptr failure;
+        try {
+            init = reduce(std::move(init), run(pieces[0].first, pieces[0].second));
+        }
+        catch (...) {
+            failure = std::current_exception();
+        }
+        for (auto& piece : pending) {
+            piece.wait();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        for (auto& piece : pending) {
+            init = reduce(std::move(init), piece.get());
+        }
+        return init;
+    }
+
+    // Singly linked list whose nodes each hold up to N elements inline. A node keeps its
+    // elements in the slot window [first, first + count), so both ends of the list grow and
+    // shrink without shifting.
+    template<class T, std::size_t N = 16, class Allocator = node_pool<T>>
+    class unrolled_forward_list {
+        static_assert(N > 0, "unrolled_forward_list needs room for at least one element per node");
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+    private:
+        struct Node;
+        using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+        using node = Node*;
+        std::size_t Size;
+        node root;
+        node tail;
+        node_allocator allocator;
+    public:
+
+        unrolled_forward_list() : Size(0), root(nullptr), tail(nullptr), allocator() {}
+
+        explicit unrolled_forward_list(std::size_t);
+
+        unrolled_forward_list(std::initializer_list<value_type>);
+
+        unrolled_forward_list(const unrolled_forward_list&);
+
+        unrolled_forward_list(unrolled_forward_list&&) noexcept;
+
+        ~unrolled_forward_list() { clear(); }
+
+        unrolled_forward_list& operator=(const unrolled_forward_list&);
+
+        unrolled_forward_list& operator=(unrolled_forward_list&&) noexcept;
+
+        std::size_t size() const { return Size; }
+
+        void push_front(const value_type& item) { emplace_front(item); }
+
+        void push_front(value_type&& item) { emplace_front(std::move(item)); }
+
+        void push_back(const value_type& item) { emplace_back(item); }
+
+        void push_back(value_type&& item) { emplace_back(std::move(item)); }
+
+        template<class... Args>
+        value_type& emplace_front(Args&&...);
+
+        template<class... Args>
+        value_type& emplace_back(Args&&...);
+
+        void insert(const value_type& item, int index) { emplace_at(index, item); }
+
+        void insert(value_type&& item, int index) { emplace_at(index, std::move(item)); }
+
+        void removeAt(int);
+
+        void pop_front();
+
+        void pop_back();
+
+        void clear();
+
+        bool empty() const { return (root) ? false : true; }
+
+        value_type& operator[](int);
+
+        value_type operator[](int) const;
+
+        template<class Predicate>
+        unrolled_forward_list split_when(Predicate&& SplitPredicate, split_mode mode = split_mode::copy);
+
+        class const_iterator;
+
+        class iterator {
+            friend class unrolled_forward_list;
+            friend class const_iterator;
+            node current;
+            std::size_t index;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            iterator() noexcept : current(nullptr), index(0) {}
+
+            explicit iterator(node right_side_hand, std::size_t Index = 0) noexcept : current(right_side_hand), index(Index) {}
+
+            reference operator*() const { return *current->at(index); }
+
+            pointer operator->() const { return current->at(index); }
+
+            iterator& operator++() {
+                if (++index == current->count) {
+                    current = current->next;
+                    index = 0;
+                }
+                return *this;
+            }
+
+            iterator operator++(int) {
+                iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            bool operator==(const iterator& right_side_hand) const { return current == right_side_hand.current && index == right_side_hand.index; }
+
+            bool operator!=(const iterator& right_side_hand) const { return !(*this == right_side_hand); }
+        };
+
+        class const_iterator {
+            friend class unrolled_forward_list;
+            const Node* current;
+            std::size_t index;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() noexcept : current(nullptr), index(0) {}
+
+            explicit const_iterator(const Node* right_side_hand, std::size_t Index = 0) noexcept : current(right_side_hand), index(Index) {}
+
+            const_iterator(const iterator& other) noexcept : current(other.current), index(other.index) {}
+
+            reference operator*() const { return *current->at(index); }
+
+            pointer operator->() const { return current->at(index); }
+
+            const_iterator& operator++() {
+                if (++index == current->count) {
+                    current = current->next;
+                    index = 0;
+                }
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            bool operator==(const const_iterator& right_side_hand) const { return current == right_side_hand.current && index == right_side_hand.index; }
+
+            bool operator!=(const const_iterator& right_side_hand) const { return !(*this == right_side_hand); }
+        };
+
+        iterator begin() { return iterator{ root }; }
+
+        iterator end() { return iterator{}; }
+
+        const_iterator begin() const { return const_iterator{ root }; }
+
+        const_iterator end() const { return const_iterator{}; }
+
+        const_iterator cbegin() const { return const_iterator{ root }; }
+
+        const_iterator cend() const { return const_iterator{}; }
+
+    private:
+
+        struct Node {
+            node next;
+            std::size_t first;
+            std::size_t count;
+            alignas(value_type) unsigned char storage[sizeof(value_type) * N];
+
+            explicit Node(std::size_t First = 0) : next(nullptr), first(First), count(0) {}
+
+            value_type* slot(std::size_t position) {
+                return std::launder(reinterpret_cast<value_type*>(storage + position * sizeof(value_type)));
+            }
+
+            const value_type* slot(std::size_t position) const {
+                return std::launder(reinterpret_cast<const value_type*>(storage + position * sizeof(value_type)));
+            }
+
+            value_type* at(std::size_t index) { return slot(first + index); }
+
+            const value_type* at(std::size_t index) const { return slot(first + index); }
+        };
+
+        static void relocate(value_type* from, value_type* to) {
+            std::construct_at(to, std::move(*from));
+            std::destroy_at(from);
+        }
+
+        node create_node(std::size_t first) {
+            node created = node_traits::allocate(allocator, 1);
+            node_traits::construct(allocator, created, first);
+            return created;
+        }
+
+        void destroy_node(node to_delete) noexcept {
+            for (std::size_t i = 0; i < to_delete->count; ++i) {
+                std::destroy_at(to_delete->at(i));
+            }
+            node_traits::destroy(allocator, to_delete);
+            node_traits::deallocate(allocator, to_delete, 1);
+        }
+
+        // Finds the node holding element index; previous receives its predecessor.
+        node locate(std::size_t& index, node* previous = nullptr) const {
+            node before = nullptr;
+            node temp = root;
+            while (index >= temp->count) {
+                index -= temp->count;
+                before = temp;
+                temp = temp->next;
+            }
+            if (previous) {
+                *previous = before;
+            }
+            return temp;
+        }
+
+        void unlink(node to_delete, node previous) noexcept {
+            if (previous) {
+                previous->next = to_delete->next;
+            }
+            else {
+                root = to_delete->next;
+            }
+            if (to_delete == tail) {
+                tail = previous;
+            }
+            destroy_node(to_delete);
+        }
+
+        node_allocator share_allocator() {
+            if constexpr (requires(node_allocator& pool) { pool.share(); }) {
+                return allocator.share();
+            }
+            else {
+                return allocator;
+            }
+        }
+
+        explicit unrolled_forward_list(node_allocator&& Shared) : Size(0), root(nullptr), tail(nullptr), allocator(std::move(Shared)) {}
+
+        template<class... Args>
+        void emplace_at(int, Args&&...);
+    };
+
+    template<class value_type, std::size_t N, class Allocator>
+    unrolled_forward_list<value_type, N, Allocator>::unrolled_forward_list(std::size_t size) : unrolled_forward_list() {
+        for (std::size_t i = 0; i < size; ++i) {
+            emplace_back();
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    unrolled_forward_list<value_type, N, Allocator>::unrolled_forward_list(std::initializer_list<value_type> list) : unrolled_forward_list() {
+        for (const value_type& item : list) {
+            emplace_back(item);
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    unrolled_forward_list<value_type, N, Allocator>::unrolled_forward_list(const unrolled_forward_list& other)
+        : Size(0), root(nullptr), tail(nullptr), allocator(node_traits::select_on_container_copy_construction(other.allocator)) {
+        for (const value_type& item : other) {
+            emplace_back(item);
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    unrolled_forward_list<value_type, N, Allocator>::unrolled_forward_list(unrolled_forward_list&& other) noexcept
+        : Size(other.Size), root(other.root), tail(other.tail), allocator(std::move(other.allocator)) {
+        other.Size = 0;
+        other.root = nullptr;
+        other.tail = nullptr;
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    unrolled_forward_list<value_type, N, Allocator>& unrolled_forward_list<value_type, N, Allocator>::operator=(const unrolled_forward_list& other)
+    {
+        if (this != &other) {
+            clear();
+            for (const value_type& item : other) {
+                emplace_back(item);
+            }
+        }
+        return *this;
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    unrolled_forward_list<value_type, N, Allocator>& unrolled_forward_list<value_type, N, Allocator>::operator=(unrolled_forward_list&& other) noexcept
+    {
+        if (this == &other) {
+            return *this;
+        }
+        clear();
+        if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+            allocator = std::move(other.allocator);
+        }
+        else if (allocator != other.allocator) {
+            for (value_type& item : other) {
+                emplace_back(std::move(item));
+            }
+            other.clear();
+            return *this;
+        }
+        Size = other.Size;
+        root = other.root;
+        tail = other.tail;
+        other.Size = 0;
+        other.root = nullptr;
+        other.tail = nullptr;
+        return *this;
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    template<class... Args>
+    value_type& unrolled_forward_list<value_type, N, Allocator>::emplace_front(Args&&... args)
+    {
+        if (root && root->first > 0) {
+            std::construct_at(root->slot(root->first - 1), std::forward<Args>(args)...);
+            root->first--;
+        }
+        else {
+            // A node opened at the front is filled from its last slot down.
+            node created = create_node(N - 1);
+            try {
+                std::construct_at(created->slot(N - 1), std::forward<Args>(args)...);
+            }
+            catch (...) {
+                destroy_node(created);
+                throw;
+            }
+            created->next = root;
+            root = created;
+            if (!tail) {
+                tail = created;
+            }
+        }
+        root->count++;
+        Size++;
+        return *root->at(0);
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    template<class... Args>
+    value_type& unrolled_forward_list<value_type, N, Allocator>::emplace_back(Args&&... args)
+    {
+        if (tail && tail->first + tail->count < N) {
+            std::construct_at(tail->slot(tail->first + tail->count), std::forward<Args>(args)...);
+        }
+        else {
+            node created = create_node(0);
+            try {
+                std::construct_at(created->slot(0), std::forward<Args>(args)...);
+            }
+            catch (...) {
+                destroy_node(created);
+                throw;
+            }
+            if (tail) {
+                tail->next = created;
+            }
+            else {
+                root = created;
+            }
+            tail = created;
+        }
+        tail->count++;
+        Size++;
+        return *tail->at(tail->count - 1);
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    template<class... Args>
+    void unrolled_forward_list<value_type, N, Allocator>::emplace_at(int index, Args&&... args)
+    {
+        if (index < 0 || static_cast<std::size_t>(index) >= Size) {
+            throw std::out_of_range("Out of Range! [unrolled_forward_list<value_type>::insert]");
+        }
+        if (!index) {
+            emplace_front(std::forward<Args>(args)...);
+            return;
+        }
+        std::size_t offset = index;
+        node target = locate(offset);
+        if (target->count == N) {
+            // Split a full node in half so that the insert only shifts within one node.
+            node created = create_node(0);
+            std::size_t keep = N / 2;
+            for (std::size_t i = keep; i < N; ++i) {
+                relocate(target->at(i), created->slot(i - keep));
+            }
+            created->count = N - keep;
+            target->count = keep;
+            created->next = target->next;
+            target->next = created;
+            if (target == tail) {
+                tail = created;
+            }
+            if (offset > keep) {
+                offset -= keep;
+                target = created;
+            }
+        }
+        value_type temp(std::forward<Args>(args)...);
+        if (target->first + target->count < N) {
+            for (std::size_t i = target->count; i > offset; --i) {
+                relocate(target->at(i - 1), target->at(i));
+            }
+        }
+        else {
+            target->first--;
+            for (std::size_t i = 0; i < offset; ++i) {
+                relocate(target->at(i + 1), target->at(i));
+            }
+        }
+        std::construct_at(target->at(offset), std::move(temp));
+        target->count++;
+        Size++;
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    void unrolled_forward_list<value_type, N, Allocator>::removeAt(int index)
+    {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
+            std::size_t offset = index;
+            node previous = nullptr;
+            node target = locate(offset, &previous);
+            std::destroy_at(target->at(offset));
+            for (std::size_t i = offset + 1; i < target->count; ++i) {
+                relocate(target->at(i), target->at(i - 1));
+            }
+            target->count--;
+            --Size;
+            if (!target->count) {
+                unlink(target, previous);
+            }
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    void unrolled_forward_list<value_type, N, Allocator>::pop_front() {
+        if (root) {
+            std::destroy_at(root->at(0));
+            root->first++;
+            root->count--;
+            --Size;
+            if (!root->count) {
+                unlink(root, nullptr);
+            }
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    void unrolled_forward_list<value_type, N, Allocator>::pop_back() {
+        if (tail) {
+            tail->count--;
+            std::destroy_at(tail->at(tail->count));
+            --Size;
+            if (!tail->count) {
+                node previous = nullptr;
+                if (tail != root) {
+                    previous = root;
+                    while (previous->next != tail) {
+                        previous = previous->next;
+                    }
+                }
+                unlink(tail, previous);
+            }
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    void unrolled_forward_list<value_type, N, Allocator>::clear() {
+        constexpr bool releasable = requires(node_allocator& pool) { pool.release(); pool.exclusive(); };
+        bool bulk = false;
+        if constexpr (releasable) {
+            bulk = allocator.exclusive();
+        }
+        node temp = root;
+        while (temp) {
+            node next = temp->next;
+            if (!bulk) {
+                destroy_node(temp);
+            }
+            else if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                for (std::size_t i = 0; i < temp->count; ++i) {
+                    std::destroy_at(temp->at(i));
+                }
+            }
+            temp = next;
+        }
+        if constexpr (releasable) {
+            if (bulk) {
+                allocator.release();
+            }
+        }
+        root = nullptr;
+        tail = nullptr;
+        Size = 0;
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    value_type& unrolled_forward_list<value_type, N, Allocator>::operator[](int index) {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
+            std::size_t offset = index;
+            node target = locate(offset);
+            return *target->at(offset);
+        }
+        else {
+            throw std::out_of_range("Out of Range! [unrolled_forward_list<value_type>::operator[]]");
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    value_type unrolled_forward_list<value_type, N, Allocator>::operator[](int index) const
+    {
+        if (index >= 0 && static_cast<std::size_t>(index) < Size) {
+            std::size_t offset = index;
+            node target = locate(offset);
+            return *target->at(offset);
+        }
+        else {
+            throw std::out_of_range("Out of Range! [unrolled_forward_list<value_type>::operator[]]");
+        }
+    }
+
+    template<class value_type, std::size_t N, class Allocator>
+    template<class Predicate>
+    unrolled_forward_list<value_type, N, Allocator> unrolled_forward_list<value_type, N, Allocator>::split_when(Predicate&& SplitPredicate, split_mode mode)
+    {
+        if (mode == split_mode::copy) {
+            auto resultList = unrolled_forward_list<value_type, N, Allocator>();
+            auto temp = cbegin();
+            while (temp != cend() && !SplitPredicate(*temp)) {
+                ++temp;
+            }
+            for (; temp != cend(); ++temp) {
+                resultList.push_back(*temp);
+            }
+            return resultList;
+        }
+        auto resultList = unrolled_forward_list<value_type, N, Allocator>(share_allocator());
+        node previous = nullptr;
+        node target = root;
+        std::size_t skipped = 0;
+        std::size_t offset = 0;
+        for (; target != nullptr; previous = target, target = target->next) {
+            for (offset = 0; offset < target->count; ++offset) {
+                if (SplitPredicate(std::as_const(*target->at(offset)))) {
+                    break;
+                }
+            }
+            if (offset < target->count) {
+                break;
+            }
+            skipped += target->count;
+        }
+        if (!target) {
+            return resultList;
+        }
+        skipped += offset;
+        if (offset) {
+            // Cut inside a node: its remainder moves to a node of its own first.
+            node created = create_node(0);
+            for (std::size_t i = offset; i < target->count; ++i) {
+                relocate(target->at(i), created->slot(i - offset));
+            }
+            created->count = target->count - offset;
+            target->count = offset;
+            created->next = target->next;
+            target->next = created;
+            if (target == tail) {
+                tail = created;
+            }
+            previous = target;
+            target = created;
+        }
+        if (previous) {
+            previous->next = nullptr;
+        }
+        else {
+            root = nullptr;
+        }
+        node chain_tail = tail;
+        std::size_t moved = Size - skipped;
+        tail = previous;
+        Size = skipped;
+        if (resultList.allocator == allocator) {
+            resultList.root = target;
+            resultList.tail = chain_tail;
+            resultList.Size = moved;
+        }
+        else {
+            while (target) {
+                node next = target->next;
+                for (std::size_t i = 0; i < target->count; ++i) {
+                    resultList.emplace_back(std::move(*target->at(i)));
+                }
+                destroy_node(target);
+                target = next;
+            }
+        }
+        return resultList;
+    }
+
+}
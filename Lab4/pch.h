@@ -6,3 +6,8 @@
 
 #include "gtest/gtest.h"
 #include "universalString.h"
+#include "mappedFile.h"
+#include "universalRope.h"
+#include "internPool.h"
+#include "myForwardList.h"
+#include "concurrentForwardList.h"
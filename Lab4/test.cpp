@@ -1,5 +1,14 @@
 #include "pch.h"
 #include <vld.h>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
 
 using namespace my_std;
 using namespace std;
@@ -69,6 +78,71 @@ TEST(universalStrign_pop_functions, pop_back_and_front) {
 	EXPECT_EQ('C', instance[0]);
 }
 
+TEST(universalStrign_push_functions, prepend_and_strip_stream) {
+	auto instance = universalStrign<char, std::vector<char>>();
+	for (int i = 0; i < 1000; i++) {
+		instance.push_front(static_cast<char>('a' + i % 26));
+		instance.push_back('z');
+	}
+	EXPECT_EQ(instance.size(), 2000);
+	EXPECT_EQ(instance[0], static_cast<char>('a' + 999 % 26));
+	EXPECT_EQ(instance[999], 'a');
+	EXPECT_EQ(instance[1000], 'z');
+	for (int i = 0; i < 1500; i++) {
+		instance.pop_front();
+	}
+	EXPECT_EQ(instance.size(), 500);
+	EXPECT_EQ(instance[0], 'z');
+	instance.push_front('h');
+	instance.pop_back();
+	EXPECT_EQ(instance.size(), 500);
+	EXPECT_EQ(instance[0], 'h');
+
+	auto empty = universalStrign<char>();
+	empty.push_front('x');
+	EXPECT_EQ(empty.size(), 1);
+	empty.pop_front();
+	EXPECT_TRUE(empty.isEmpty());
+}
+
+TEST(universalStrign_push_functions, reuse_moved_from) {
+	auto instance = universalStrign<char>("a string too long to stay inline");
+	instance.push_front('>');
+	auto moved = std::move(instance);
+	EXPECT_TRUE(instance.isEmpty());
+	EXPECT_EQ(universalStrign_view<char>(instance).size(), 0);
+	instance.push_back('x');
+	instance.push_front('w');
+	EXPECT_TRUE(instance == universalStrign<char>("wx"));
+
+	auto other = universalStrign<char, std::vector<char>>("reused");
+	auto target = universalStrign<char, std::vector<char>>();
+	target = std::move(other);
+	EXPECT_TRUE(other.isEmpty());
+	EXPECT_EQ(other.capacity(), 0);
+	EXPECT_EQ(universalStrign_view<char>(other), universalStrign_view<char>(""));
+	other.push_back('y');
+	EXPECT_EQ(universalStrign_view<char>(other), universalStrign_view<char>("y"));
+	EXPECT_EQ(universalStrign_view<char>(other).data()[1], '\0');
+	EXPECT_EQ(moved[0], '>');
+	EXPECT_EQ(target.size(), 6);
+	auto front = std::move(other);
+	other.push_front('z');
+	EXPECT_EQ(universalStrign_view<char>(other), universalStrign_view<char>("z"));
+	EXPECT_EQ(universalStrign_view<char>(other).data()[1], '\0');
+	auto appended = std::move(front);
+	front.append("abc", 3);
+	EXPECT_EQ(universalStrign_view<char>(front), universalStrign_view<char>("abc"));
+
+	// Moving a string into itself leaves it unchanged.
+	auto& alias = target;
+	target = std::move(alias);
+	EXPECT_EQ(universalStrign_view<char>(target), universalStrign_view<char>("reused"));
+	std::ostringstream out;
+	out << target;
+	EXPECT_EQ(out.str(), "reused");
+}
+
 TEST(universalStrign_pop_functions, clear) {
 	auto instance = universalStrign<char>("TextText");
 	instance.clear();
@@ -157,6 +231,99 @@ TEST(universalStrign_Functor, dynamic_polimorf_new_string) {
 	}
 }
 
+TEST(universalStrign_Functor, block_kernels) {
+	auto text = universalStrign<char>("Mixed Case Text, with 123 digits and [brackets] @ the END! ") * 3;
+	auto reference = text;
+	for (size_t i = 0; i < reference.size(); i++) {
+		reference[i] = static_cast<char>(toupper(reference[i]));
+	}
+	auto upper = transform(text, ascii_upper());
+	EXPECT_TRUE(upper == reference);
+	upper.transform(ascii_lower());
+	for (size_t i = 0; i < upper.size(); i++) {
+		EXPECT_EQ(upper[i], static_cast<char>(tolower(text[i])));
+	}
+
+	auto hidden = transform(text, xor_bytes(0x5A));
+	EXPECT_NE(hidden[0], text[0]);
+	hidden.transform(xor_bytes(0x5A));
+	EXPECT_TRUE(hidden == text);
+	hidden.transform(add_bytes(200));
+	hidden.transform(add_bytes(56));
+	EXPECT_TRUE(hidden == text);
+
+	auto rot13 = lookup_table::from([](unsigned char value) -> unsigned char {
+		if (isalpha(value)) {
+			unsigned char base = isupper(value) ? 'A' : 'a';
+			return static_cast<unsigned char>(base + (value - base + 13) % 26);
+		}
+		return value;
+	});
+	auto rotated = transform(text, rot13);
+	EXPECT_EQ(rotated[0], 'Z');
+	rotated.transform(rot13);
+	EXPECT_TRUE(rotated == text);
+
+	auto wide = universalStrign<wchar_t>(L"wide text");
+	wide.transform(ascii_upper());
+	EXPECT_TRUE(wide == universalStrign<wchar_t>(L"WIDE TEXT"));
+}
+
+TEST(universalStrign_Functor, dynamic_block_transform) {
+	struct shiftFunctor : public blockTransformer<shiftFunctor, char> {
+		char operator()(char value) override { return value + 1; }
+	} shift;
+	struct countingFunctor : public ITransformer<char> {
+		int blocks = 0;
+		char operator()(char value) override { return value - 1; }
+		void transform_block(const char* first, char* out, std::size_t count) override {
+			blocks++;
+			ITransformer<char>::transform_block(first, out, count);
+		}
+	} counting;
+
+	auto instance = universalStrign<char>("TextTextText") * 10;
+	auto shifted = transformDyn(instance, &shift);
+	EXPECT_EQ(shifted[0], 'U');
+	shifted.transformDyn(&counting);
+	EXPECT_EQ(counting.blocks, 1);
+	EXPECT_TRUE(shifted == instance);
+	EXPECT_TRUE(transformDyn(universalStrign<char>().substr_view(0), &shift).isEmpty());
+}
+
+TEST(universalStrign_parallel, transform_count_find_reduce) {
+	thread_pool pool(4);
+	auto text = universalStrign<char>("abcdefghij") * 10007;
+	auto serial = transform(text, ascii_upper());
+	text.parallel_transform(ascii_upper(), pool, 1000);
+	EXPECT_TRUE(text == serial);
+
+	EXPECT_EQ(text.parallel_count('C', pool, 1000), 10007);
+	EXPECT_EQ(text.parallel_count('c', pool, 1000), 0);
+	EXPECT_EQ(text.parallel_find('D', pool, 1000), 3);
+	text[90000] = '!';
+	text[95000] = '!';
+	EXPECT_EQ(text.parallel_find('!', pool, 1000), 90000);
+	EXPECT_EQ(text.parallel_find('?', pool, 1000), universalStrign<char>::npos);
+
+	long long sum = text.parallel_transform_reduce(0LL, std::plus<>(), [](char value) { return static_cast<long long>(value); }, pool, 1000);
+	long long expected = 0;
+	for (size_t i = 0; i < text.size(); i++) {
+		expected += text[i];
+	}
+	EXPECT_EQ(sum, expected);
+	auto small = universalStrign<char>("abc");
+	EXPECT_EQ(small.parallel_transform_reduce(universalStrign<char>(), std::plus<>(),
+		[](char value) { return universalStrign<char>(value); }, pool, 1) == small, true);
+	EXPECT_EQ(universalStrign<char>().parallel_transform_reduce(7, std::plus<>(), [](char) { return 1; }, pool), 7);
+	EXPECT_THROW(text.parallel_transform([](char value) -> char {
+		if (value == '!') {
+			throw std::runtime_error("failure");
+		}
+		return value;
+	}, pool, 1000), std::runtime_error);
+}
+
 TEST(universalStrign_compare, equal) {
 	auto instance = universalStrign<char>("TextTextText");
 	auto instance2 = universalStrign<char>("TextTextText");
@@ -191,6 +358,37 @@ TEST(universalStrign_compare, less) {
 	EXPECT_TRUE(instance < instance2);
 }
 
+TEST(universalStrign_compare, lexicographic_order) {
+	auto shorter = universalStrign<char>("Text");
+	auto longer = universalStrign<char>("TextText");
+	auto later = universalStrign<char>("Tf");
+	EXPECT_TRUE(shorter < longer);
+	EXPECT_TRUE(longer < later);
+	EXPECT_FALSE(later <= longer);
+	EXPECT_TRUE(longer >= longer);
+
+	auto wide = universalStrign<char32_t>(std::size_t(100), U'x');
+	auto wideOther = wide;
+	EXPECT_TRUE(wide == wideOther);
+	wideOther[70] = U'y';
+	EXPECT_TRUE(wide != wideOther);
+	EXPECT_TRUE(wide < wideOther);
+	wideOther[70] = U'w';
+	EXPECT_TRUE(wide > wideOther);
+
+	auto block = universalStrign<char>(std::size_t(64), 'a');
+	auto negative = block;
+	negative[40] = static_cast<char>(-1);
+	EXPECT_EQ(block < negative, 'a' < static_cast<char>(-1));
+
+	universalStrign<universalStrign<char>> words;
+	universalStrign<universalStrign<char>> otherWords;
+	words.push_back(shorter);
+	otherWords.push_back(longer);
+	EXPECT_TRUE(words < otherWords);
+	EXPECT_FALSE(words == otherWords);
+}
+
 TEST(universalStrign, concate) {
 	auto instance = universalStrign<char>("ABC");
 	auto instance2 = universalStrign<char>("BCD");
@@ -211,6 +409,116 @@ TEST(universalStrign, multiply) {
 	EXPECT_TRUE(result == instance);
 }
 
+TEST(universalStrign, reserve_and_bulk_append) {
+	auto instance = universalStrign<char>("0123456789");
+	auto repeated = instance * 1000;
+	EXPECT_EQ(repeated.size(), 10000);
+	EXPECT_EQ(repeated.capacity(), repeated.size());
+	EXPECT_EQ(repeated[9999], '9');
+	EXPECT_TRUE((instance * 0).isEmpty());
+
+	auto text = universalStrign<char>();
+	text.reserve(100);
+	EXPECT_GE(text.capacity(), 100);
+	text.append("abc", 3);
+	text.push_back(text);
+	text.append(text);
+	EXPECT_EQ(text.size(), 12);
+	EXPECT_EQ(text[11], 'c');
+	text.push_front('x');
+	text.shrink_to_fit();
+	EXPECT_LT(text.capacity(), 100);
+	EXPECT_EQ(text[0], 'x');
+	EXPECT_EQ(text[12], 'c');
+}
+
+TEST(universalStrign_view, slice_without_copying) {
+	auto line = universalStrign<char>("name,42,Kyiv");
+	auto name = line.substr_view(0, 4);
+	auto number = line.substr_view(5, 2);
+	auto city = line.split_view(8);
+	EXPECT_EQ(name.size(), 4);
+	EXPECT_EQ(city.data(), name.data() + 8);
+	EXPECT_EQ(line.substr_view(8).size(), 4);
+	EXPECT_THROW(line.split_view(12), std::out_of_range);
+	EXPECT_THROW(line.substr_view(13), std::out_of_range);
+
+	EXPECT_TRUE(city == universalStrign_view<char>("Kyiv"));
+	EXPECT_TRUE(city < name);
+	EXPECT_TRUE(number <= number);
+	EXPECT_FALSE(universalStrign_view<char>("ab") > universalStrign_view<char>("abc"));
+	auto owned = universalStrign<char>(city);
+	EXPECT_TRUE(owned == city);
+	EXPECT_EQ(owned.size(), 4);
+
+	auto upper = transform(name, [](char value) { return static_cast<char>(toupper(value)); });
+	EXPECT_EQ(upper[0], 'N');
+	EXPECT_EQ(upper.size(), 4);
+	std::ostringstream out;
+	out << name << ' ' << number;
+	EXPECT_EQ(out.str(), "name 42");
+}
+
+TEST(universalStrign_search, find_against_std_string) {
+	std::mt19937 generator(7);
+	std::string haystack;
+	for (int i = 0; i < 5000; i++) {
+		haystack.push_back(static_cast<char>('a' + generator() % 3));
+	}
+	auto instance = universalStrign<char>(haystack.c_str());
+	for (std::size_t length = 0; length <= 40; length++) {
+		std::size_t start = generator() % (haystack.size() - length);
+		std::string needle = haystack.substr(start, length);
+		auto own = universalStrign_view<char>(needle.data(), needle.size());
+		EXPECT_EQ(instance.find(own), haystack.find(needle));
+		EXPECT_EQ(instance.find(own, start + 1), haystack.find(needle, start + 1));
+		EXPECT_EQ(instance.rfind(own), haystack.rfind(needle));
+		EXPECT_EQ(instance.rfind(own, start), haystack.rfind(needle, start));
+		needle.push_back('d');
+		EXPECT_EQ(instance.find(universalStrign_view<char>(needle.data(), needle.size())), universalStrign<char>::npos);
+	}
+
+	for (std::size_t length : { 256, 300 }) {
+		std::size_t start = generator() % (haystack.size() - length);
+		std::string needle = haystack.substr(start, length);
+		EXPECT_EQ(instance.find(universalStrign_view<char>(needle.data(), length)), haystack.find(needle));
+		needle[length / 2] = 'd';
+		EXPECT_EQ(instance.find(universalStrign_view<char>(needle.data(), length)), universalStrign<char>::npos);
+	}
+
+	auto searcherNeedle = universalStrign<char>("abcabcabcabcabcabc");
+	auto prepared = searcher<char>(searcherNeedle.substr_view(0).data(), searcherNeedle.size());
+	auto line = universalStrign<char>("xx") + searcherNeedle + universalStrign<char>("yy");
+	EXPECT_EQ(line.find(prepared), 2);
+	EXPECT_EQ(line.find(prepared, 3), universalStrign<char>::npos);
+}
+
+TEST(universalStrign_search, contains_count_and_find_first_of) {
+	auto log = universalStrign<char>("GET /index.html 200\nGET /missing 404\nPOST /form 200\n");
+	EXPECT_TRUE(log.contains("404"));
+	EXPECT_FALSE(log.contains("500"));
+	EXPECT_TRUE(log.contains('\n'));
+	EXPECT_EQ(log.count("200"), 2);
+	EXPECT_EQ(log.count("GET"), 2);
+	EXPECT_EQ(log.count('\n'), 3);
+	EXPECT_EQ(universalStrign<char>("aaaa").count("aa"), 2);
+	EXPECT_EQ(log.find_first_of(" /"), 3);
+	EXPECT_EQ(log.find_first_of("0123456789", 20), 33);
+	EXPECT_EQ(log.find('P'), 37);
+	EXPECT_EQ(log.rfind('G'), 20);
+
+	auto wide = universalStrign<char16_t>(u"\u0411\u0412 long wide needle search \u0412\u0413");
+	EXPECT_EQ(wide.find(u"long wide needle search"), 3);
+	EXPECT_EQ(wide.find(u"\u0412\u0413"), 27);
+	EXPECT_EQ(wide.rfind(u'\u0412'), 27);
+
+	universalStrign<universalStrign<char>> words;
+	words.push_back(universalStrign<char>("one"));
+	words.push_back(universalStrign<char>("two"));
+	EXPECT_EQ(words.find(universalStrign<char>("two")), 1);
+	EXPECT_TRUE(words.contains(universalStrign<char>("one")));
+}
+
 TEST(universalStrign, make_string) {
 	auto arr = "TEXTtext";
 	auto str1 = make_string(arr);
@@ -227,6 +535,272 @@ TEST(universalStrign, input_output_from_console) {
 	std::cout << instance << std::endl;
 }
 
+TEST(universalStrign, bulk_stream_io) {
+	auto big = universalStrign<char>("0123456789") * 1000;
+	std::ostringstream out;
+	out << big << ' ' << universalStrign<char>("tail");
+	EXPECT_EQ(out.str().size(), 10005);
+
+	std::istringstream in(out.str() + "\n  next");
+	auto word = universalStrign<char>("pre_");
+	in >> word;
+	EXPECT_EQ(word.size(), 10004);
+	EXPECT_EQ(word[4], '0');
+	auto second = universalStrign<char>();
+	auto third = universalStrign<char>();
+	in >> second >> third;
+	EXPECT_TRUE(second == universalStrign<char>("tail"));
+	EXPECT_TRUE(third == universalStrign<char>("next"));
+	EXPECT_TRUE(in.eof());
+	in >> third;
+	EXPECT_TRUE(in.fail());
+
+	std::wostringstream wideOut;
+	wideOut << universalStrign<wchar_t>(L"wide");
+	EXPECT_EQ(wideOut.str(), L"wide");
+}
+
+TEST(universalStrign, getline_and_chunked_reads) {
+	std::istringstream lines("first line\n\nthird;rest");
+	auto line = universalStrign<char>("old");
+	EXPECT_TRUE(getline(lines, line));
+	EXPECT_TRUE(line == universalStrign<char>("first line"));
+	EXPECT_TRUE(getline(lines, line));
+	EXPECT_TRUE(line.isEmpty());
+	EXPECT_TRUE(getline(lines, line, ';'));
+	EXPECT_TRUE(line == universalStrign<char>("third"));
+	EXPECT_TRUE(getline(lines, line));
+	EXPECT_TRUE(line == universalStrign<char>("rest"));
+	EXPECT_FALSE(getline(lines, line));
+
+	std::istringstream payload(std::string(10000, 'x'));
+	auto chunks = universalStrign<char>();
+	std::size_t reads = 0;
+	while (chunks.append_from(payload, 4096)) {
+		reads++;
+	}
+	EXPECT_EQ(reads, 3);
+	EXPECT_EQ(chunks.size(), 10000);
+	EXPECT_TRUE(payload.eof());
+
+	std::FILE* file = std::tmpfile();
+	ASSERT_NE(file, nullptr);
+	std::fputs("descriptor contents", file);
+	std::fflush(file);
+	std::rewind(file);
+#if defined(_WIN32)
+	int descriptor = _fileno(file);
+#else
+	int descriptor = fileno(file);
+#endif
+	auto fromFile = universalStrign<char>();
+	EXPECT_EQ(fromFile.append_from(descriptor, 10), 10);
+	EXPECT_EQ(fromFile.append_from(descriptor, 100), 9);
+	EXPECT_EQ(fromFile.append_from(descriptor, 100), 0);
+	EXPECT_TRUE(fromFile == universalStrign<char>("descriptor contents"));
+	EXPECT_THROW(fromFile.append_from(-1, 10), std::system_error);
+	EXPECT_EQ(fromFile.size(), 19);
+	std::fclose(file);
+}
+
+TEST(universalStrign, mapped_file_reads_in_place) {
+	auto path = std::filesystem::temp_directory_path() / "my_std_mapped_file_test.txt";
+	{
+		std::ofstream out(path, std::ios::binary);
+		out << "alpha,beta,gamma\nsecond line";
+	}
+	auto mapped = make_mapped_string<char>(path.string().c_str());
+	EXPECT_EQ(mapped.size(), 28);
+	EXPECT_EQ(std::as_const(mapped)[6], 'b');
+	auto adopted = universalStrign<char, mapped_file<char>>(mapped_file<char>(path.string().c_str()));
+	EXPECT_TRUE(mapped == adopted);
+	EXPECT_EQ(mapped.find(universalStrign_view<char>("gamma")), 11);
+	EXPECT_TRUE(mapped.contains('\n'));
+	auto line = mapped.substr_view(0, mapped.find('\n'));
+	EXPECT_TRUE(line == universalStrign_view<char>("alpha,beta,gamma"));
+	EXPECT_TRUE(line.substr_view(6, 4) == universalStrign_view<char>("beta"));
+	std::ostringstream out;
+	out << mapped;
+	EXPECT_EQ(out.str(), "alpha,beta,gamma\nsecond line");
+
+	auto copy = mapped;
+	copy.push_back('!');
+	copy[0] = 'A';
+	EXPECT_EQ(copy.size(), 29);
+	EXPECT_EQ(copy[0], 'A');
+	EXPECT_EQ(std::as_const(mapped)[0], 'a');
+	EXPECT_TRUE(make_mapped_string<char>(path.string().c_str()) == mapped);
+
+	{
+		std::ofstream truncate(path, std::ios::binary);
+	}
+	auto empty = make_mapped_string<char>(path.string().c_str());
+	EXPECT_TRUE(empty.isEmpty());
+	empty.push_back('x');
+	EXPECT_EQ(empty.size(), 1);
+	std::filesystem::remove(path);
+	EXPECT_THROW(make_mapped_string<char>(path.string().c_str()), std::system_error);
+
+	// Adopted storage gets a terminator when it is empty or does not end with one.
+	auto unmapped = universalStrign<char, mapped_file<char>>(mapped_file<char>());
+	EXPECT_TRUE(unmapped.isEmpty());
+	EXPECT_EQ(universalStrign_view<char>(unmapped).data()[0], '\0');
+	using vector_string = universalStrign<char, std::vector<char>>;
+	auto bare = vector_string(std::vector<char>{ 'a', 'b' });
+	EXPECT_EQ(bare.size(), 2);
+	EXPECT_EQ(universalStrign_view<char>(bare).data()[2], '\0');
+	auto terminated = vector_string(std::vector<char>{ 'a', 'b', '\0' });
+	EXPECT_TRUE(terminated == bare);
+	EXPECT_TRUE(vector_string(std::vector<char>()).isEmpty());
+}
+
+TEST(universalStrign, hash_and_unordered_keys) {
+	auto key = universalStrign<char>("dedup key");
+	EXPECT_EQ(std::hash<universalStrign<char>>()(key), std::hash<universalStrign_view<char>>()(universalStrign_view<char>("dedup key")));
+	EXPECT_NE(key.hash(), universalStrign<char>("dedup kex").hash());
+	EXPECT_NE(universalStrign<wchar_t>(L"ab").hash(), universalStrign<wchar_t>(L"ba").hash());
+
+	// Lengths around the short, 16-byte and 48-byte paths, one changed byte at a time.
+	std::unordered_set<std::size_t> seen;
+	std::string text(200, 'x');
+	for (std::size_t length = 0; length <= 200; length++)
+	{
+		for (std::size_t i = 0; i < length; i++)
+		{
+			std::string changed = text.substr(0, length);
+			changed[i] = 'y';
+			seen.insert(hash_chars(changed.data(), changed.size()));
+		}
+		seen.insert(hash_chars(text.data(), length));
+	}
+	EXPECT_EQ(seen.size(), 201 * 202 / 2);
+
+	std::unordered_map<universalStrign<char>, int, universalStrign_hash, std::equal_to<>> counts;
+	for (const char* word : { "alpha", "beta", "alpha", "gamma", "alpha" }) {
+		counts[universalStrign<char>(word)]++;
+	}
+	EXPECT_EQ(counts.size(), 3);
+	auto found = counts.find(universalStrign_view<char>("alpha"));
+	ASSERT_NE(found, counts.end());
+	EXPECT_EQ(found->second, 3);
+	EXPECT_EQ(counts.count(universalStrign_view<char>("delta")), 0);
+	std::unordered_set<universalStrign<universalStrign<char>>> nested;
+	auto pair = universalStrign<universalStrign<char>>(universalStrign<char>("a"));
+	pair.push_back(universalStrign<char>("b"));
+	nested.insert(pair);
+	EXPECT_EQ(nested.count(pair), 1);
+
+	auto cached = universalStrign<char, HashCachingContainer<char>>("cached key");
+	std::size_t before = cached.hash();
+	EXPECT_EQ(before, hash_chars("cached key", 10));
+	EXPECT_EQ(cached.hash(), before);
+	cached.push_back('!');
+	EXPECT_EQ(cached.hash(), hash_chars("cached key!", 11));
+	cached.transform(ascii_upper());
+	EXPECT_EQ(cached.hash(), hash_chars("CACHED KEY!", 11));
+	cached[0] = 'c';
+	EXPECT_EQ(cached.hash(), hash_chars("cACHED KEY!", 11));
+	cached.pop_front();
+	EXPECT_EQ(cached.hash(), hash_chars("ACHED KEY!", 10));
+	auto copy = cached;
+	EXPECT_EQ(copy.hash(), cached.hash());
+	std::unordered_set<universalStrign<char, HashCachingContainer<char>>> cachedKeys;
+	cachedKeys.insert(std::move(copy));
+	EXPECT_EQ(cachedKeys.count(cached), 1);
+}
+
+TEST(universalStrign, compile_time_strings) {
+	// Built, grown past the inline buffer, transformed and compared during constant
+	// evaluation; only the results leave it.
+	constexpr bool built = [] {
+		auto text = universalStrign<char>("compile") + universalStrign<char>("-time");
+		text.transform(ascii_upper());
+		auto longer = text * 8;
+		longer.push_front('>');
+		longer.pop_back();
+		return text == universalStrign<char>("COMPILE-TIME") && text.size() == 12 && text[7] == '-'
+			&& longer.size() == 96 && longer[0] == '>' && longer < universalStrign<char>("?")
+			&& transform(text, ascii_lower()) == universalStrign<char>("compile-time");
+	}();
+	static_assert(built);
+	constexpr std::size_t hashed = universalStrign<char>("alpha").hash();
+	static_assert(hashed == hash_chars("alpha", 5));
+	EXPECT_EQ(hashed, universalStrign<char>("alpha").hash());
+
+	constexpr auto key = "alpha"_fixed;
+	static_assert(key.size() == 5 && key[4] == 'a');
+	static_assert(key.hash() == hashed);
+	static_assert(key.transform(ascii_upper()) == "ALPHA"_fixed);
+	static_assert(key + "-beta"_fixed == "alpha-beta"_fixed);
+	static_assert(key < "alphabet"_fixed && !("beta"_fixed < key) && !(key == "alp"_fixed));
+	static_assert(u"wide"_fixed.hash() == universalStrign<char16_t>(u"wide").hash());
+	EXPECT_EQ(universalStrign_view<char>(key), universalStrign_view<char>("alpha"));
+
+	// Keys hashed longer than one 48-byte block and a table of their hashes.
+	constexpr std::array<std::size_t, 3> table = {
+		"GET"_fixed.hash(), "POST"_fixed.hash(), "a header name well past forty-eight bytes long!!"_fixed.hash() };
+	static_assert(table[2] != table[1]);
+	auto method = [&table](universalStrign_view<char> name) -> std::ptrdiff_t {
+		std::size_t hash = hash_chars(name.data(), name.size());
+		switch (hash) {
+		case "GET"_fixed.hash():
+			return 0;
+		case "POST"_fixed.hash():
+			return 1;
+		default:
+			return std::find(table.begin(), table.end(), hash) - table.begin();
+		}
+	};
+	EXPECT_EQ(method(universalStrign<char>("GET")), 0);
+	EXPECT_EQ(method(universalStrign<char>("POST")), 1);
+	EXPECT_EQ(method(universalStrign<char>("a header name well past forty-eight bytes long!!")), 2);
+	EXPECT_EQ(method(universalStrign<char>("PUT")), 3);
+}
+
+TEST(intern_pool, one_copy_per_value) {
+	intern_pool<char> pool;
+	auto name = pool.intern("field_name");
+	auto same = pool.intern(universalStrign<char>("field_name"));
+	auto other = pool.intern(universalStrign_view<char>("enum_tag"));
+	EXPECT_TRUE(name == same);
+	EXPECT_EQ(&name.str(), &same.str());
+	EXPECT_TRUE(name != other);
+	EXPECT_TRUE(name.str() == universalStrign<char>("field_name"));
+	EXPECT_EQ(universalStrign_view<char>(other).size(), 8);
+	EXPECT_TRUE(pool.intern("") == interned_strign<char>());
+	EXPECT_TRUE(interned_strign<char>().isEmpty());
+	EXPECT_EQ(pool.size(), 2);
+	EXPECT_EQ(std::hash<interned_strign<char>>()(name), std::hash<interned_strign<char>>()(same));
+
+	// Threads racing to intern the same values must all get the same handles.
+	std::vector<std::vector<interned_strign<char>>> results(4);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < results.size(); t++)
+	{
+		threads.emplace_back([&pool, &results, t] {
+			for (std::size_t i = 0; i < 2000; i++)
+			{
+				auto text = universalStrign<char>("tag_") + universalStrign<char>(std::to_string((i * 7 + t) % 500).c_str());
+				results[t].push_back(pool.intern(text));
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	EXPECT_EQ(pool.size(), 502);
+	for (std::size_t t = 0; t < results.size(); t++)
+	{
+		for (std::size_t i = 0; i < 2000; i++)
+		{
+			auto expected = universalStrign<char>("tag_") + universalStrign<char>(std::to_string((i * 7 + t) % 500).c_str());
+			EXPECT_TRUE(results[t][i].str() == expected);
+			EXPECT_TRUE(results[t][i] == pool.intern(expected));
+		}
+	}
+	EXPECT_TRUE(intern_pool<wchar_t>::shared().intern(L"shared") == intern_pool<wchar_t>::shared().intern(L"shared"));
+}
+
 TEST(universalStrign, convert) {
 	universalStrign<wchar_t> instance (L"ABC_");
 	auto instance_char = convert<char, wchar_t>(instance);
@@ -234,6 +808,53 @@ TEST(universalStrign, convert) {
 	std::cout << typeid(instance_char).name() << std::endl;
 }
 
+TEST(universalStrign, convert_unicode) {
+	// The UTF-8 bytes are spelled out so the test does not depend on the source encoding.
+	auto utf8 = universalStrign<char>("Gr\xC3\xBC\xC3\x9F" "e, \xE4\xB8\x96\xE7\x95\x8C \xF0\x9F\x8C\x8D");
+	auto utf16 = universalStrign<char16_t>(u"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F30D");
+	auto utf32 = universalStrign<char32_t>(U"Gr\u00FC\u00DFe, \u4E16\u754C \U0001F30D");
+	EXPECT_TRUE(convert<char16_t>(utf8) == utf16);
+	EXPECT_TRUE(convert<char32_t>(utf8) == utf32);
+	EXPECT_TRUE(convert<char>(utf16) == utf8);
+	EXPECT_TRUE(convert<char>(utf32) == utf8);
+	EXPECT_TRUE(convert<char32_t>(utf16) == utf32);
+	EXPECT_TRUE(convert<char16_t>(utf32) == utf16);
+	EXPECT_TRUE(convert<char>(convert<wchar_t>(utf8)) == utf8);
+	EXPECT_EQ(convert<char16_t>(utf8).size(), 12);
+
+	// Long runs cover the block paths, with non-ASCII at every offset within a block.
+	std::mt19937 random(7);
+	for (std::size_t round = 0; round < 200; round++)
+	{
+		auto points = universalStrign<char32_t>();
+		std::size_t length = random() % 100;
+		for (std::size_t i = 0; i < length; i++)
+		{
+			char32_t point = static_cast<char32_t>('a' + i % 26);
+			switch (random() % 16) {
+			case 0: point = 0xE9; break;
+			case 1: point = 0x4E16; break;
+			case 2: point = 0x1F30D; break;
+			}
+			points.push_back(point);
+		}
+		auto bytes = convert<char>(points);
+		auto units = convert<char16_t>(bytes);
+		EXPECT_TRUE(convert<char32_t>(units) == points);
+		EXPECT_TRUE(convert<char>(units) == bytes);
+		EXPECT_TRUE(convert<char32_t>(bytes) == points);
+	}
+
+	const char* malformed[] = { "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "abc\xE2\x82", "\x80", "\xF8\x88\x80\x80\x80" };
+	for (const char* bytes : malformed) {
+		EXPECT_THROW(convert<char32_t>(universalStrign<char>(bytes)), std::range_error);
+	}
+	EXPECT_THROW(convert<char>(universalStrign<char16_t>(u"x\xD800y")), std::range_error);
+	EXPECT_THROW(convert<char>(universalStrign<char16_t>(u"\xDC00")), std::range_error);
+	EXPECT_THROW(convert<char16_t>(universalStrign<char32_t>(U"\x110000")), std::range_error);
+	EXPECT_TRUE(convert<char16_t>(universalStrign<char>()).isEmpty());
+}
+
 TEST(universalStrign, stringOfstring_test) {
 	universalStrign<char> instance("ABC_");
 	universalStrign<universalStrign<char>> instanceStr;
@@ -243,4 +864,566 @@ TEST(universalStrign, stringOfstring_test) {
 	instanceStr2.push_back(instance);
 	EXPECT_EQ(instanceStr.size(), 2);
 	EXPECT_TRUE(instanceStr == instanceStr2);
-}
\ No newline at end of file
+}
+
+TEST(universalStrign, short_strings_stay_inline) {
+	small_vector<char> inlineOnly;
+	EXPECT_EQ(inlineOnly.capacity(), small_vector<char>::inline_capacity());
+	const char* before = inlineOnly.data();
+	for (char c = 'a'; c < 'a' + 20; c++) {
+		inlineOnly.push_back(c);
+	}
+	EXPECT_EQ(inlineOnly.data(), before);
+
+	auto instance = universalStrign<char>("short text");
+	auto moved = std::move(instance);
+	EXPECT_EQ(moved.size(), 10);
+	EXPECT_EQ(moved[9], 't');
+	auto copy = moved * 5;
+	EXPECT_EQ(copy.size(), 50);
+	EXPECT_EQ(copy[49], 't');
+}
+
+TEST(universalRope, concat_split_and_index) {
+	auto rope = universalRope<char>("Hello, ") + universalRope<char>("World");
+	EXPECT_EQ(rope.size(), 12);
+	EXPECT_EQ(rope[7], 'W');
+	EXPECT_TRUE(rope.flatten() == universalStrign<char>("Hello, World"));
+	EXPECT_TRUE(rope.split(7).flatten() == universalStrign<char>("World").split(0));
+	EXPECT_THROW(rope.split(12), std::out_of_range);
+	EXPECT_THROW(rope[12], std::out_of_range);
+	EXPECT_TRUE(universalRope<char>().isEmpty());
+	std::ostringstream out;
+	out << rope;
+	EXPECT_EQ(out.str(), "Hello, World");
+
+	// Random pieces of assorted sizes against std::string.
+	std::mt19937 random(11);
+	universalRope<char> document;
+	std::string expected;
+	for (std::size_t i = 0; i < 3000; i++)
+	{
+		std::size_t length = random() % 4 ? random() % 20 + 1 : random() % 600 + 1;
+		std::string piece(length, static_cast<char>('a' + i % 26));
+		if (random() % 2) {
+			document.append(universalRope<char>(piece.c_str()));
+			expected += piece;
+		}
+		else {
+			document = universalRope<char>(piece.c_str()) + document;
+			expected = piece + expected;
+		}
+	}
+	ASSERT_EQ(document.size(), expected.size());
+	EXPECT_EQ(std::string(document.begin(), document.end()), expected);
+	for (std::size_t i = 0; i < 200; i++)
+	{
+		std::size_t index = random() % expected.size();
+		EXPECT_EQ(document[index], expected[index]);
+		std::size_t count = random() % 5000;
+		auto piece = document.substr(index, count);
+		EXPECT_EQ(std::string(piece.begin(), piece.end()), expected.substr(index, count));
+		auto tail = document.split(index);
+		EXPECT_EQ(tail.size(), expected.size() - index);
+		EXPECT_EQ(tail[0], expected[index]);
+	}
+	auto copy = document;
+	copy.append(copy);
+	EXPECT_EQ(copy.size(), 2 * expected.size());
+	EXPECT_EQ(document.size(), expected.size());
+	EXPECT_TRUE(copy.substr(expected.size()).flatten() == document.flatten());
+
+	// Appending into a leaf that a copy still shares must leave the copy alone.
+	auto small = universalRope<char>("abc");
+	auto shared = small;
+	small.append("def");
+	small.append(small);
+	small.append(universalStrign<char>("!"));
+	EXPECT_TRUE(small.flatten() == universalStrign<char>("abcdefabcdef!"));
+	EXPECT_TRUE(shared.flatten() == universalStrign<char>("abc"));
+}
+
+TEST(small_vector, grow_copy_and_move) {
+	small_vector<std::string, 2> instance;
+	for (int i = 0; i < 10; i++) {
+		instance.emplace_back(std::to_string(i));
+	}
+	EXPECT_EQ(instance.size(), 10);
+	EXPECT_GE(instance.capacity(), 10);
+	instance.push_back(instance[0]);
+	EXPECT_EQ(instance.back(), "0");
+
+	auto copy = instance;
+	auto moved = std::move(instance);
+	EXPECT_TRUE(instance.empty());
+	EXPECT_EQ(copy.size(), 11);
+	EXPECT_EQ(moved[9], "9");
+
+	while (moved.size() > 2) {
+		moved.pop_back();
+	}
+	moved.shrink_to_fit();
+	EXPECT_EQ(moved.capacity(), 2);
+	EXPECT_EQ(moved[1], "1");
+	small_vector<std::string, 2> small;
+	small.push_back("x");
+	small = std::move(moved);
+	EXPECT_EQ(small[0], "0");
+}
+
+TEST(forward_list_construct, initializer_list_and_copy) {
+	forward_list<int> instance{ 1, 2, 3 };
+	EXPECT_EQ(instance.size(), 3);
+	auto copy = instance;
+	copy[0] = 10;
+	EXPECT_EQ(instance[0], 1);
+	EXPECT_EQ(copy[0], 10);
+	EXPECT_EQ(copy[2], 3);
+}
+
+TEST(forward_list_construct, move_takes_nodes) {
+	forward_list<int> instance{ 1, 2, 3 };
+	auto instance2 = std::move(instance);
+	EXPECT_EQ(instance.size(), 0);
+	EXPECT_TRUE(instance.empty());
+	EXPECT_EQ(instance2.size(), 3);
+	forward_list<int> instance3{ 7 };
+	instance3 = std::move(instance2);
+	EXPECT_EQ(instance3.size(), 3);
+	EXPECT_EQ(instance3[1], 2);
+}
+
+TEST(forward_list_allocator, node_pool_reuses_slots) {
+	node_pool<int, 4> pool;
+	int* first = pool.allocate(1);
+	pool.deallocate(first, 1);
+	int* second = pool.allocate(1);
+	EXPECT_EQ(first, second);
+	pool.deallocate(second, 1);
+}
+
+TEST(forward_list_allocator, node_pool_grows_and_adopts) {
+	// Chunks grow from 8 slots to the cap; adopted pools stay alive with their new owner.
+	node_pool<int, 64> pool;
+	std::vector<int*> items;
+	for (int i = 0; i < 300; i++) {
+		items.push_back(pool.allocate(1));
+		*items.back() = i;
+	}
+	node_pool<int, 64> donor;
+	int* moved = donor.allocate(1);
+	*moved = -1;
+	pool.adopt(donor);
+	EXPECT_TRUE(donor.exclusive());
+	node_pool<int, 64> empty;
+	int* again = pool.allocate(1);
+	*again = -2;
+	empty.adopt(pool);
+	for (int i = 0; i < 300; i++) {
+		EXPECT_EQ(*items[i], i);
+		empty.deallocate(items[i], 1);
+	}
+	EXPECT_EQ(*moved, -1);
+	empty.deallocate(moved, 1);
+	empty.deallocate(again, 1);
+	empty.release();
+	EXPECT_NE(empty.allocate(1), nullptr);
+
+	forward_list<int> target{ 1, 2 };
+	forward_list<int> source{ 3, 4, 5 };
+	target.splice_after(target.begin(), source);
+	source.push_back(6);
+	EXPECT_TRUE(std::ranges::equal(target, std::vector<int>{ 1, 3, 4, 5, 2 }));
+	EXPECT_EQ(source[0], 6);
+}
+
+TEST(forward_list_allocator, std_allocator_list) {
+	forward_list<universalStrign<char>, std::allocator<universalStrign<char>>> instance;
+	instance.push_back(universalStrign<char>("ABC"));
+	instance.push_front(universalStrign<char>("DEF"));
+	instance.removeAt(1);
+	EXPECT_EQ(instance.size(), 1);
+	universalStrign<char> expected("DEF");
+	EXPECT_TRUE(instance[0] == expected);
+}
+
+TEST(forward_list_push_functions, push_back_keeps_tail) {
+	forward_list<int> instance;
+	for (int i = 0; i < 100000; i++)
+	{
+		instance.push_back(i);
+	}
+	EXPECT_EQ(instance.size(), 100000);
+	instance.removeAt(99999);
+	instance.pop_back();
+	instance.push_back(-1);
+	EXPECT_EQ(instance[99998], -1);
+	instance.clear();
+	instance.push_back(5);
+	instance.push_front(4);
+	instance.push_back(6);
+	EXPECT_EQ(instance[0], 4);
+	EXPECT_EQ(instance[2], 6);
+
+	forward_list<int> moved;
+	moved = std::move(instance);
+	moved.push_back(7);
+	EXPECT_EQ(moved[3], 7);
+	instance.push_back(1);
+	EXPECT_EQ(instance.size(), 1);
+}
+
+TEST(forward_list_pop_functions, clear_and_reuse) {
+	forward_list<universalStrign<char>> instance;
+	for (int i = 0; i < 1000; i++)
+	{
+		instance.push_back(universalStrign<char>("TextText"));
+	}
+	instance.clear();
+	EXPECT_TRUE(instance.empty());
+	EXPECT_EQ(instance.size(), 0);
+	instance.push_back(universalStrign<char>("ABC"));
+	universalStrign<char> expected("ABC");
+	EXPECT_TRUE(instance[0] == expected);
+}
+
+TEST(forward_list_positional, insert_and_erase_after) {
+	forward_list<int> instance{ 1, 3 };
+	auto position = instance.insert_after(instance.begin(), 2);
+	EXPECT_EQ(*position, 2);
+	instance.emplace_after(instance.before_begin(), 0);
+	instance.insert_after(instance.before_begin(), -1);
+	instance.erase_after(instance.before_begin());
+	EXPECT_EQ(instance.size(), 4);
+	for (int i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(instance[i], i);
+	}
+	auto it = instance.begin();
+	++it;
+	++it;
+	instance.erase_after(it);
+	instance.push_back(4);
+	EXPECT_EQ(instance.size(), 4);
+	EXPECT_EQ(instance[3], 4);
+	instance.erase_after(instance.before_begin(), instance.end());
+	EXPECT_TRUE(instance.empty());
+	instance.push_back(5);
+	EXPECT_EQ(instance[0], 5);
+}
+
+TEST(forward_list_positional, splice_after) {
+	forward_list<int> instance{ 1, 5 };
+	forward_list<int> other{ 2, 3, 4 };
+	instance.splice_after(instance.begin(), other);
+	EXPECT_TRUE(other.empty());
+	EXPECT_EQ(instance.size(), 5);
+	for (int i = 0; i < 5; i++)
+	{
+		EXPECT_EQ(instance[i], i + 1);
+	}
+
+	forward_list<int> tail{ 6, 7, 8 };
+	auto last = tail.begin();
+	++last;
+	auto back = instance.begin();
+	for (int i = 0; i < 4; i++)
+	{
+		++back;
+	}
+	instance.splice_after(back, tail, tail.before_begin(), last);
+	EXPECT_EQ(instance.size(), 6);
+	EXPECT_EQ(tail.size(), 2);
+	EXPECT_EQ(instance[5], 6);
+	instance.push_back(9);
+	EXPECT_EQ(instance[6], 9);
+
+	instance.splice_after(instance.before_begin(), instance, instance.begin(), instance.end());
+	EXPECT_EQ(instance.size(), 7);
+	EXPECT_EQ(instance[0], 2);
+	EXPECT_EQ(instance[6], 1);
+	instance.push_back(10);
+	EXPECT_EQ(instance[7], 10);
+}
+
+TEST(forward_list_iterator, standard_algorithms) {
+	static_assert(std::forward_iterator<forward_list<int>::iterator>);
+	static_assert(std::forward_iterator<forward_list<int>::const_iterator>);
+	static_assert(std::ranges::forward_range<forward_list<int>>);
+	static_assert(std::is_same_v<std::iterator_traits<forward_list<char>::iterator>::reference, char&>);
+
+	forward_list<int> instance{ 1, 2, 3, 4 };
+	EXPECT_EQ(std::accumulate(instance.begin(), instance.end(), 0), 10);
+	auto found = std::find(instance.begin(), instance.end(), 3);
+	EXPECT_EQ(*found, 3);
+	EXPECT_EQ(std::ranges::count_if(instance, [](int value) { return value % 2 == 0; }), 2);
+
+	auto it = instance.begin();
+	auto previous = it++;
+	EXPECT_EQ(*previous, 1);
+	EXPECT_EQ(*it, 2);
+
+	const forward_list<int>& constInstance = instance;
+	int sum = 0;
+	for (const int& value : constInstance) {
+		sum += value;
+	}
+	EXPECT_EQ(sum, 10);
+	forward_list<int>::const_iterator converted = instance.begin();
+	EXPECT_TRUE(converted == constInstance.begin());
+}
+
+TEST(forward_list_iterator, range_for_over_strings) {
+	forward_list<universalStrign<char>> instance;
+	instance.push_back(universalStrign<char>("AB"));
+	instance.push_back(universalStrign<char>("CD"));
+	for (auto& value : instance) {
+		value.push_back('!');
+	}
+	universalStrign<char> expected("CD!");
+	EXPECT_TRUE(instance[1] == expected);
+	EXPECT_EQ(instance.begin()->size(), 3);
+}
+
+TEST(forward_list_push_functions, emplace_constructs_in_place) {
+	struct counted {
+		int value;
+		int* copies;
+		counted(int Value, int* Copies) : value(Value), copies(Copies) {}
+		counted(const counted& other) : value(other.value), copies(other.copies) { (*copies)++; }
+		counted(counted&& other) noexcept : value(other.value), copies(other.copies) { (*copies)++; }
+	};
+
+	int copies = 0;
+	forward_list<counted> instance;
+	instance.emplace_back(2, &copies);
+	instance.emplace_front(1, &copies);
+	instance.emplace_after(instance.begin(), 5, &copies);
+	EXPECT_EQ(copies, 0);
+	EXPECT_EQ(instance[0].value, 1);
+	EXPECT_EQ(instance[1].value, 5);
+	EXPECT_EQ(instance[2].value, 2);
+
+	forward_list<universalStrign<char>> strings;
+	auto& created = strings.emplace_back(std::size_t(3), 'A');
+	EXPECT_EQ(created.size(), 3);
+	universalStrign<char> expected("AAA");
+	EXPECT_TRUE(strings[0] == expected);
+
+	forward_list<universalStrign<char>> defaults(std::size_t(2));
+	EXPECT_EQ(defaults.size(), 2);
+	EXPECT_TRUE(defaults[1].isEmpty());
+}
+
+TEST(unrolled_forward_list, matches_reference_sequence) {
+	unrolled_forward_list<int, 4> instance;
+	std::vector<int> reference;
+	for (int i = 0; i < 200; i++)
+	{
+		switch (i % 7) {
+		case 0: case 1:
+			instance.push_back(i);
+			reference.push_back(i);
+			break;
+		case 2:
+			instance.push_front(i);
+			reference.insert(reference.begin(), i);
+			break;
+		case 3: case 4:
+			instance.insert(i, static_cast<int>(reference.size() / 2));
+			reference.insert(reference.begin() + reference.size() / 2, i);
+			break;
+		case 5:
+			instance.removeAt(static_cast<int>(reference.size() / 3));
+			reference.erase(reference.begin() + reference.size() / 3);
+			break;
+		case 6:
+			instance.pop_back();
+			reference.pop_back();
+			instance.pop_front();
+			reference.erase(reference.begin());
+			break;
+		}
+	}
+	ASSERT_EQ(instance.size(), reference.size());
+	EXPECT_TRUE(std::equal(instance.begin(), instance.end(), reference.begin(), reference.end()));
+	for (size_t i = 0; i < reference.size(); i++)
+	{
+		EXPECT_EQ(instance[static_cast<int>(i)], reference[i]);
+	}
+	EXPECT_THROW(instance.insert(0, static_cast<int>(reference.size())), std::out_of_range);
+}
+
+TEST(unrolled_forward_list, copy_move_and_split) {
+	static_assert(std::ranges::forward_range<unrolled_forward_list<int>>);
+	unrolled_forward_list<std::string, 2> instance;
+	instance.push_back("A");
+	instance.push_back("B");
+	instance.push_back("C");
+	auto copy = instance;
+	auto moved = std::move(copy);
+	EXPECT_EQ(copy.size(), 0);
+	EXPECT_EQ(moved.size(), 3);
+	auto splitted = moved.split_when([](std::string value) { return value == "B"; });
+	EXPECT_EQ(splitted.size(), 2);
+	EXPECT_EQ(splitted[1], "C");
+	while (!moved.empty()) {
+		moved.pop_back();
+	}
+	EXPECT_EQ(moved.size(), 0);
+}
+
+TEST(forward_list_split, copy_keeps_source) {
+	forward_list<int> instance{ 1, 2, 3, 4 };
+	auto result = instance.split_when([](const int& value) { return value == 3; });
+	EXPECT_EQ(instance.size(), 4);
+	EXPECT_EQ(result.size(), 2);
+	EXPECT_EQ(result[0], 3);
+	forward_list<int> empty;
+	EXPECT_TRUE(empty.split_when([](int value) { return value == 3; }).empty());
+	std::function<bool(int)> never = [](int) { return false; };
+	EXPECT_TRUE(instance.split_when(never).empty());
+}
+
+TEST(forward_list_split, cut_hands_over_tail) {
+	auto result = forward_list<int>();
+	{
+		forward_list<int> instance{ 1, 2, 3, 4, 5 };
+		result = instance.split_when([](int value) { return value == 3; }, split_mode::cut);
+		EXPECT_EQ(instance.size(), 2);
+		EXPECT_EQ(result.size(), 3);
+		instance.push_back(10);
+		result.push_back(11);
+		EXPECT_EQ(instance[2], 10);
+		EXPECT_EQ(result[0], 3);
+		EXPECT_EQ(result[3], 11);
+
+		auto last = instance.begin();
+		++last;
+		++last;
+		result.splice_after(result.before_begin(), instance, instance.begin(), last);
+		EXPECT_EQ(instance.size(), 2);
+		EXPECT_EQ(result[0], 2);
+	}
+	EXPECT_EQ(result.size(), 5);
+	result.push_front(0);
+	EXPECT_EQ(result[0], 0);
+
+	auto whole = result.split_when([](int value) { return value == 0; }, split_mode::cut);
+	EXPECT_TRUE(result.empty());
+	EXPECT_EQ(whole.size(), 6);
+	result.push_back(1);
+	EXPECT_EQ(result[0], 1);
+}
+
+TEST(unrolled_forward_list, cut_inside_node) {
+	unrolled_forward_list<int, 4> instance{ 1, 2, 3, 4, 5, 6, 7 };
+	auto result = instance.split_when([](int value) { return value == 3; }, split_mode::cut);
+	EXPECT_EQ(instance.size(), 2);
+	EXPECT_EQ(result.size(), 5);
+	EXPECT_TRUE(std::ranges::equal(result, std::vector<int>{ 3, 4, 5, 6, 7 }));
+	instance.push_back(8);
+	result.push_back(9);
+	EXPECT_TRUE(std::ranges::equal(instance, std::vector<int>{ 1, 2, 8 }));
+	EXPECT_EQ(result[5], 9);
+}
+
+TEST(concurrent_forward_list, push_pop_stress) {
+	concurrent_forward_list<int> instance;
+	const int producers = 4;
+	const int perThread = 20000;
+	std::atomic<long long> poppedSum = 0;
+	std::atomic<int> poppedCount = 0;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < producers; t++)
+	{
+		threads.emplace_back([&instance, t, perThread] {
+			for (int i = 1; i <= perThread; i++)
+			{
+				instance.push_front(t * perThread + i);
+			}
+		});
+		threads.emplace_back([&instance, &poppedSum, &poppedCount, perThread] {
+			for (int i = 0; i < perThread / 2; i++)
+			{
+				if (auto value = instance.pop_front()) {
+					poppedSum += *value;
+					poppedCount++;
+				}
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	auto rest = instance.take_all();
+	EXPECT_TRUE(instance.empty());
+	long long total = poppedSum;
+	for (int value : rest) {
+		total += value;
+	}
+	long long count = producers * perThread;
+	EXPECT_EQ(poppedCount + static_cast<int>(rest.size()), count);
+	EXPECT_EQ(total, count * (count + 1) / 2);
+}
+
+TEST(concurrent_forward_list, take_all_keeps_order) {
+	concurrent_forward_list<std::string> instance;
+	instance.push_front("C");
+	instance.push_front("B");
+	instance.emplace_front(1, 'A');
+	auto front = instance.pop_front();
+	ASSERT_TRUE(front.has_value());
+	EXPECT_EQ(*front, "A");
+	auto rest = instance.take_all();
+	EXPECT_TRUE(std::ranges::equal(rest, std::vector<std::string>{ "B", "C" }));
+	EXPECT_FALSE(instance.pop_front().has_value());
+}
+
+TEST(forward_list_algorithms, sort_is_stable) {
+	forward_list<std::pair<int, int>> instance;
+	for (int i = 0; i < 1000; i++)
+	{
+		instance.push_back({ (i * 7919) % 10, i });
+	}
+	instance.sort([](const auto& left, const auto& right) { return left.first < right.first; });
+	EXPECT_EQ(instance.size(), 1000);
+	EXPECT_TRUE(std::is_sorted(instance.begin(), instance.end()));
+	instance.push_back({ 100, 0 });
+	EXPECT_EQ(instance[1000].first, 100);
+}
+
+TEST(forward_list_algorithms, merge_reverse_unique_remove) {
+	forward_list<int> instance{ 1, 3, 5, 7 };
+	forward_list<int> other{ 2, 3, 6, 8 };
+	instance.merge(other);
+	EXPECT_TRUE(other.empty());
+	EXPECT_TRUE(std::ranges::equal(instance, std::vector<int>{ 1, 2, 3, 3, 5, 6, 7, 8 }));
+	EXPECT_EQ(instance.unique(), 1);
+	instance.reverse();
+	EXPECT_TRUE(std::ranges::equal(instance, std::vector<int>{ 8, 7, 6, 5, 3, 2, 1 }));
+	EXPECT_EQ(instance.remove_if([](int value) { return value % 2 == 0; }), 3);
+	EXPECT_TRUE(std::ranges::equal(instance, std::vector<int>{ 7, 5, 3, 1 }));
+	instance.push_back(0);
+	EXPECT_EQ(instance.size(), 5);
+	EXPECT_EQ(instance[4], 0);
+}
+
+TEST(forward_list_algorithms, parallel_for_each_and_reduce) {
+	thread_pool pool(4);
+	forward_list<long long> instance;
+	for (long long i = 1; i <= 100000; i++)
+	{
+		instance.push_back(i);
+	}
+	instance.parallel_for_each([](long long& value) { value *= 2; }, pool, 1000);
+	auto sum = instance.parallel_transform_reduce(0LL, std::plus<>(), [](long long value) { return value; }, pool, 1000);
+	EXPECT_EQ(sum, 100000LL * 100001LL);
+	auto serial = instance.parallel_transform_reduce(1LL, std::plus<>(), [](long long value) { return value / 2; }, pool, 1000000);
+	EXPECT_EQ(serial, 100000LL * 100001LL / 2 + 1);
+	EXPECT_THROW(instance.parallel_for_each([](long long& value) {
+		if (value == 2) {
+			throw std::runtime_error("failure");
+		}
+	}, pool, 1000), std::runtime_error);
+}
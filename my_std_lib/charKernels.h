@@ -0,0 +1,294 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MY_STD_AVX2 1
+#define MY_STD_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MY_STD_SSE2 1
+#endif
+
+namespace my_std {
+
+	// Character types whose equality is equality of their bytes, so runs of them can be
+	// compared a block at a time. Class types such as universalStrign<char> fall back to
+	// their own operators.
+	template <class charT>
+	inline constexpr bool is_bitwise_comparable = std::is_integral_v<charT>;
+
+	// Character types std::char_traits is defined for.
+	template <class charT>
+	inline constexpr bool is_standard_char = std::is_same_v<charT, char> || std::is_same_v<charT, wchar_t>
+		|| std::is_same_v<charT, char8_t> || std::is_same_v<charT, char16_t> || std::is_same_v<charT, char32_t>;
+
+	// Index of the first byte where the two runs differ, or count if they do not.
+	inline std::size_t mismatch_bytes(const unsigned char* first1, const unsigned char* first2, std::size_t count) {
+		// Short runs never reach the wide loads, which also lets the compiler see that they
+		// stay inside short constant arrays.
+		if (count < 16) {
+			for (std::size_t i = 0; i < count; i++)
+			{
+				if (first1[i] != first2[i]) {
+					return i;
+				}
+			}
+			return count;
+		}
+		std::size_t i = 0;
+#if defined(MY_STD_AVX2)
+		for (; i + 32 <= count; i += 32)
+		{
+			__m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1 + i));
+			__m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2 + i));
+			unsigned differ = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block1, block2)));
+			if (differ) {
+				return i + std::countr_zero(differ);
+			}
+		}
+#endif
+#if defined(MY_STD_SSE2)
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1 + i));
+			__m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2 + i));
+			unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2))) & 0xFFFFu;
+			if (differ) {
+				return i + std::countr_zero(differ);
+			}
+		}
+		if (i < count) {
+			// Finish with one block that overlaps bytes already known to be equal.
+			std::size_t last = count - 16;
+			__m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1 + last));
+			__m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2 + last));
+			unsigned differ = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2))) & 0xFFFFu;
+			return differ ? last + std::countr_zero(differ) : count;
+		}
+#endif
+		if constexpr (std::endian::native == std::endian::little) {
+			for (; i + 8 <= count; i += 8)
+			{
+				std::uint64_t word1;
+				std::uint64_t word2;
+				std::memcpy(&word1, first1 + i, 8);
+				std::memcpy(&word2, first2 + i, 8);
+				if (word1 != word2) {
+					return i + std::countr_zero(word1 ^ word2) / 8;
+				}
+			}
+		}
+		for (; i < count; i++)
+		{
+			if (first1[i] != first2[i]) {
+				return i;
+			}
+		}
+		return count;
+	}
+
+	// The kernels below also run in constant expressions, where they take a plain loop.
+	template <class charT>
+	constexpr bool equal_chars(const charT* first1, const charT* first2, std::size_t count) {
+		if (std::is_constant_evaluated()) {
+			return std::equal(first1, first1 + count, first2);
+		}
+		if constexpr (is_bitwise_comparable<charT>) {
+			return !count || std::memcmp(first1, first2, count * sizeof(charT)) == 0;
+		}
+		else {
+			return std::equal(first1, first1 + count, first2);
+		}
+	}
+
+	// Index of the first position where the runs differ, or count if they do not.
+	template <class charT>
+	constexpr std::size_t mismatch_chars(const charT* first1, const charT* first2, std::size_t count) {
+		if (std::is_constant_evaluated()) {
+			return std::mismatch(first1, first1 + count, first2).first - first1;
+		}
+		if constexpr (is_bitwise_comparable<charT>) {
+			return mismatch_bytes(reinterpret_cast<const unsigned char*>(first1),
+				reinterpret_cast<const unsigned char*>(first2), count * sizeof(charT)) / sizeof(charT);
+		}
+		else {
+			return std::mismatch(first1, first1 + count, first2).first - first1;
+		}
+	}
+
+	// Lexicographic three-way comparison: negative, zero or positive like memcmp. Characters
+	// are ordered by charT's own operator<, and a proper prefix orders first.
+	template <class charT>
+	constexpr int compare_chars(const charT* first1, std::size_t size1, const charT* first2, std::size_t size2) {
+		std::size_t common = std::min(size1, size2);
+		std::size_t index = mismatch_chars(first1, first2, common);
+		if (index < common) {
+			return first1[index] < first2[index] ? -1 : 1;
+		}
+		return size1 < size2 ? -1 : size1 > size2 ? 1 : 0;
+	}
+
+	// Writes functor(first[i]) to out[i] for count characters; out may equal first. A
+	// functor with an apply(first, out, count) member handles the whole run itself,
+	// otherwise the loop runs over raw pointers and counts the compiler can vectorize.
+	template <class charT, class Functor>
+	constexpr void transform_chars(const charT* first, charT* out, std::size_t count, Functor& functor) {
+		if constexpr (requires { functor.apply(first, out, count); }) {
+			if (!std::is_constant_evaluated()) {
+				functor.apply(first, out, count);
+				return;
+			}
+		}
+		for (std::size_t i = 0; i < count; i++)
+		{
+			out[i] = functor(first[i]);
+		}
+	}
+
+	// Runs block over 16 bytes at a time when SSE2 is available and scalar over the rest.
+	template <class Block, class Scalar>
+	void transform_bytes(const unsigned char* first, unsigned char* out, std::size_t count, Block block, Scalar scalar) {
+		std::size_t i = 0;
+#if defined(MY_STD_SSE2)
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), block(value));
+		}
+#else
+		(void)block;
+#endif
+		for (; i < count; i++)
+		{
+			out[i] = scalar(first[i]);
+		}
+	}
+
+	// Built-in transforms with block kernels for one-byte characters. Wider characters run
+	// through the same scalar rule.
+	template <class Derived>
+	struct byte_transform {
+		template <class charT>
+		void apply(const charT* first, charT* out, std::size_t count) const {
+			const Derived& self = static_cast<const Derived&>(*this);
+			if constexpr (sizeof(charT) == 1) {
+#if defined(MY_STD_SSE2)
+				auto block = [&self](__m128i value) { return self.block(value); };
+#else
+				auto block = [](auto value) { return value; };
+#endif
+				transform_bytes(reinterpret_cast<const unsigned char*>(first), reinterpret_cast<unsigned char*>(out), count,
+					block, [&self](unsigned char value) { return self(value); });
+			}
+			else {
+				for (std::size_t i = 0; i < count; i++)
+				{
+					out[i] = self(first[i]);
+				}
+			}
+		}
+	};
+
+	struct ascii_upper : byte_transform<ascii_upper> {
+		template <class charT>
+		constexpr charT operator()(charT value) const { return value >= 'a' && value <= 'z' ? static_cast<charT>(value - ('a' - 'A')) : value; }
+
+#if defined(MY_STD_SSE2)
+		__m128i block(__m128i value) const {
+			// Shift 'a'..'z' down to the 26 smallest signed bytes, then one compare finds them.
+			__m128i shifted = _mm_sub_epi8(value, _mm_set1_epi8(static_cast<char>('a' + 128)));
+			__m128i lower = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+			return _mm_sub_epi8(value, _mm_and_si128(lower, _mm_set1_epi8(0x20)));
+		}
+#endif
+	};
+
+	struct ascii_lower : byte_transform<ascii_lower> {
+		template <class charT>
+		constexpr charT operator()(charT value) const { return value >= 'A' && value <= 'Z' ? static_cast<charT>(value + ('a' - 'A')) : value; }
+
+#if defined(MY_STD_SSE2)
+		__m128i block(__m128i value) const {
+			__m128i shifted = _mm_sub_epi8(value, _mm_set1_epi8(static_cast<char>('A' + 128)));
+			__m128i upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + 26)));
+			return _mm_add_epi8(value, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		}
+#endif
+	};
+
+	// Adds a constant to every character, wrapping around.
+	struct add_bytes : byte_transform<add_bytes> {
+		constexpr explicit add_bytes(unsigned char Value) : value(Value) {}
+
+		template <class charT>
+		constexpr charT operator()(charT item) const { return static_cast<charT>(item + value); }
+
+#if defined(MY_STD_SSE2)
+		__m128i block(__m128i item) const { return _mm_add_epi8(item, _mm_set1_epi8(static_cast<char>(value))); }
+#endif
+
+		unsigned char value;
+	};
+
+	struct xor_bytes : byte_transform<xor_bytes> {
+		constexpr explicit xor_bytes(unsigned char Key) : key(Key) {}
+
+		template <class charT>
+		constexpr charT operator()(charT item) const { return static_cast<charT>(item ^ key); }
+
+#if defined(MY_STD_SSE2)
+		__m128i block(__m128i item) const { return _mm_xor_si128(item, _mm_set1_epi8(static_cast<char>(key))); }
+#endif
+
+		unsigned char key;
+	};
+
+	// Maps every character below 256 through a 256-entry table; wider ones pass through.
+	struct lookup_table {
+		template <class Function>
+		static constexpr lookup_table from(Function function) {
+			lookup_table result{};
+			for (unsigned i = 0; i < 256; i++)
+			{
+				result.table[i] = static_cast<unsigned char>(function(static_cast<unsigned char>(i)));
+			}
+			return result;
+		}
+
+		template <class charT>
+		constexpr charT operator()(charT value) const {
+			auto index = static_cast<std::make_unsigned_t<charT>>(value);
+			return index < 256 ? static_cast<charT>(table[index]) : value;
+		}
+
+		template <class charT>
+		void apply(const charT* first, charT* out, std::size_t count) const {
+			// No byte gather before AVX-512, so unroll to keep several loads in flight.
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				charT value0 = (*this)(first[i]);
+				charT value1 = (*this)(first[i + 1]);
+				charT value2 = (*this)(first[i + 2]);
+				charT value3 = (*this)(first[i + 3]);
+				out[i] = value0;
+				out[i + 1] = value1;
+				out[i + 2] = value2;
+				out[i + 3] = value3;
+			}
+			for (; i < count; i++)
+			{
+				out[i] = (*this)(first[i]);
+			}
+		}
+
+		unsigned char table[256];
+	};
+}
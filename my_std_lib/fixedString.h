@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include "charKernels.h"
+#include "stringHash.h"
+#include "universalStringView.h"
+
+namespace my_std {
+
+	// String of exactly N characters held inline, followed by a terminator. It is a literal
+	// structural type, so it can be a constexpr variable, a template argument or an element
+	// of a constant table, which a universalStrign cannot outlive constant evaluation as.
+	// Hashes and comparisons agree with universalStrign and universalStrign_view.
+	template <class charT, std::size_t N>
+	struct fixed_universalStrign {
+		// Public so the type stays structural; treat it as read-only.
+		charT chars[N + 1] = {};
+
+		constexpr fixed_universalStrign() = default;
+
+		constexpr fixed_universalStrign(const charT(&Array)[N + 1]) {
+			for (std::size_t i = 0; i < N; i++)
+			{
+				chars[i] = Array[i];
+			}
+		}
+
+		static constexpr std::size_t size() noexcept { return N; }
+
+		static constexpr bool isEmpty() noexcept { return !N; }
+
+		constexpr const charT* data() const noexcept { return chars; }
+
+		constexpr charT operator[](std::size_t index) const {
+			if (index < N) {
+				return chars[index];
+			}
+			else {
+				throw std::out_of_range("Out of range error [fixed_universalStrign<charT, N>::operator[]]");
+			}
+		}
+
+		constexpr operator universalStrign_view<charT>() const noexcept { return universalStrign_view<charT>(chars, N); }
+
+		constexpr std::size_t hash() const { return hash_chars(chars, N); }
+
+		// Functor is one of the constexpr transforms of charKernels.h or any constexpr
+		// charT(charT) callable.
+		template <class Functor>
+		constexpr fixed_universalStrign transform(Functor functor) const {
+			fixed_universalStrign result;
+			transform_chars(chars, result.chars, N, functor);
+			return result;
+		}
+
+		template <std::size_t M>
+		friend constexpr fixed_universalStrign<charT, N + M> operator+(const fixed_universalStrign& string1, const fixed_universalStrign<charT, M>& string2) {
+			fixed_universalStrign<charT, N + M> result;
+			for (std::size_t i = 0; i < N; i++)
+			{
+				result.chars[i] = string1.chars[i];
+			}
+			for (std::size_t i = 0; i < M; i++)
+			{
+				result.chars[N + i] = string2.chars[i];
+			}
+			return result;
+		}
+
+		template <std::size_t M>
+		friend constexpr bool operator==(const fixed_universalStrign& string1, const fixed_universalStrign<charT, M>& string2) {
+			return N == M && equal_chars(string1.chars, string2.chars, N);
+		}
+
+		template <std::size_t M>
+		friend constexpr bool operator<(const fixed_universalStrign& string1, const fixed_universalStrign<charT, M>& string2) {
+			return compare_chars(string1.chars, N, string2.chars, M) < 0;
+		}
+	};
+
+	template <class charT, std::size_t N>
+	fixed_universalStrign(const charT(&)[N]) -> fixed_universalStrign<charT, N - 1>;
+
+	inline namespace literals {
+
+		// "text"_fixed is a fixed_universalStrign of the literal's characters, usable in
+		// constant expressions: "key"_fixed.hash() can label a case or fill a constexpr table.
+		template <fixed_universalStrign Text>
+		constexpr auto operator""_fixed() { return Text; }
+	}
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+#include "universalString.h"
+
+namespace my_std {
+
+	template <class charT>
+	class intern_pool;
+
+	// Handle to a value stored once in an intern_pool: a single pointer, compared and
+	// hashed by identity. Handles from the same pool are equal exactly when their texts
+	// are. Valid for as long as the pool; the default handle is the empty string.
+	template <class charT>
+	class interned_strign {
+	public:
+		interned_strign() noexcept : value(empty_value()) {}
+
+		const universalStrign<charT>& str() const noexcept { return *value; }
+
+		const universalStrign<charT>& operator*() const noexcept { return *value; }
+
+		const universalStrign<charT>* operator->() const noexcept { return value; }
+
+		std::size_t size() const noexcept { return value->size(); }
+
+		bool isEmpty() const noexcept { return value->isEmpty(); }
+
+		operator universalStrign_view<charT>() const { return *value; }
+
+		friend bool operator==(interned_strign handle1, interned_strign handle2) noexcept { return handle1.value == handle2.value; }
+
+		friend bool operator!=(interned_strign handle1, interned_strign handle2) noexcept { return handle1.value != handle2.value; }
+
+		template <class streamCharT, class Traits>
+		friend std::basic_ostream<streamCharT, Traits>& operator<<(std::basic_ostream<streamCharT, Traits>& out, interned_strign handle) {
+			return out << *handle.value;
+		}
+
+	private:
+		friend class intern_pool<charT>;
+
+		explicit interned_strign(const universalStrign<charT>* Value) noexcept : value(Value) {}
+
+		static const universalStrign<charT>* empty_value() {
+			static const universalStrign<charT> empty;
+			return &empty;
+		}
+
+		const universalStrign<charT>* value;
+	};
+
+	// Keeps one immutable copy of each distinct text and hands out interned_strign handles
+	// to it. Values are never removed. Inserts are thread-safe: the index is split into
+	// shards by hash, each behind its own reader-writer lock, so lookups of values already
+	// present only take shared locks and inserts into different shards do not contend.
+	template <class charT>
+	class intern_pool {
+	public:
+		intern_pool() = default;
+
+		intern_pool(const intern_pool&) = delete;
+
+		intern_pool& operator=(const intern_pool&) = delete;
+
+		interned_strign<charT> intern(universalStrign_view<charT> text) {
+			if (text.isEmpty()) {
+				return interned_strign<charT>();
+			}
+			entry probe{ text, hash_chars(text.data(), text.size()), nullptr };
+			// Shards take the top bits of the hash, leaving the low ones to the buckets.
+			shard& part = shards[probe.hash >> (sizeof(std::size_t) * 8 - shard_bits)];
+			{
+				std::shared_lock<std::shared_mutex> lock(part.guard);
+				auto found = part.index.find(probe);
+				if (found != part.index.end()) {
+					return interned_strign<charT>(found->value);
+				}
+			}
+			std::lock_guard<std::shared_mutex> lock(part.guard);
+			auto found = part.index.find(probe);
+			if (found != part.index.end()) {
+				return interned_strign<charT>(found->value);
+			}
+			const universalStrign<charT>& stored = part.values.emplace_back(text);
+			part.index.insert(entry{ stored, probe.hash, &stored });
+			return interned_strign<charT>(&stored);
+		}
+
+		template <class Container>
+		interned_strign<charT> intern(const universalStrign<charT, Container>& text) { return intern(universalStrign_view<charT>(text)); }
+
+		interned_strign<charT> intern(const charT* Array) { return intern(universalStrign_view<charT>(Array)); }
+
+		// Distinct non-empty values stored.
+		std::size_t size() const {
+			std::size_t result = 0;
+			for (const shard& part : shards) {
+				std::shared_lock<std::shared_mutex> lock(part.guard);
+				result += part.values.size();
+			}
+			return result;
+		}
+
+		// Process-wide pool, created on first use.
+		static intern_pool& shared() {
+			static intern_pool instance;
+			return instance;
+		}
+
+	private:
+		// The text points into the stored value; probes carry no value.
+		struct entry {
+			universalStrign_view<charT> text;
+			std::size_t hash;
+			const universalStrign<charT>* value;
+		};
+
+		struct entry_hash {
+			std::size_t operator()(const entry& item) const noexcept { return item.hash; }
+		};
+
+		struct entry_equal {
+			bool operator()(const entry& item1, const entry& item2) const { return item1.text == item2.text; }
+		};
+
+		// Padded to a cache line so neighbouring locks do not share one.
+		struct alignas(64) shard {
+			mutable std::shared_mutex guard;
+			std::deque<universalStrign<charT>> values;
+			std::unordered_set<entry, entry_hash, entry_equal> index;
+		};
+
+		static constexpr std::size_t shard_bits = 4;
+
+		std::array<shard, std::size_t(1) << shard_bits> shards;
+	};
+}
+
+template <class charT>
+struct std::hash<my_std::interned_strign<charT>> {
+	std::size_t operator()(my_std::interned_strign<charT> handle) const noexcept {
+		return std::hash<const my_std::universalStrign<charT>*>()(handle.operator->());
+	}
+};
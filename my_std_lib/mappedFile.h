@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <system_error>
+#include <cerrno>
+#include "universalString.h"
+
+// Not included by universalString.h, so only code that uses the policy sees the platform
+// headers. Whatever is defined here to tame <windows.h> is undefined again below.
+#if defined(_WIN32)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#define MY_STD_MAPPED_FILE_NOMINMAX
+#endif
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#define MY_STD_MAPPED_FILE_LEAN
+#endif
+#include <windows.h>
+#if defined(MY_STD_MAPPED_FILE_NOMINMAX)
+#undef NOMINMAX
+#undef MY_STD_MAPPED_FILE_NOMINMAX
+#endif
+#if defined(MY_STD_MAPPED_FILE_LEAN)
+#undef WIN32_LEAN_AND_MEAN
+#undef MY_STD_MAPPED_FILE_LEAN
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace my_std {
+
+	// Container policy for universalStrign that reads its characters straight from a
+	// read-only memory mapping of a file, so loading costs no copy and processes mapping the
+	// same file share the page cache. Copies share the mapping.
+	//
+	// Const access reads the mapping. The first mutating or non-const access copies the
+	// characters into owned storage and drops this object's share of the mapping; the file
+	// itself is never written. The terminator universalStrign keeps after its characters is
+	// virtual while mapped: size() counts it, but nothing reads it until the copy exists.
+	template <class charT>
+	class mapped_file {
+	public:
+		using value_type = charT;
+		using size_type = std::size_t;
+		using iterator = charT*;
+		using const_iterator = const charT*;
+
+		mapped_file() noexcept : mapped(nullptr), count(0) {}
+
+		// Maps the whole file; a trailing partial character is ignored. Throws
+		// std::system_error when the file cannot be opened or mapped.
+		explicit mapped_file(const char* path) : mapped(nullptr), count(0) {
+			auto created = std::make_shared<Mapping>(path);
+			count = created->bytes / sizeof(charT);
+			if (count) {
+				mapped = static_cast<const charT*>(created->address);
+				mapping = std::move(created);
+			}
+			else {
+				owned.push_back(charT());
+			}
+		}
+
+		bool is_mapped() const noexcept { return mapping != nullptr; }
+
+		std::size_t size() const noexcept { return mapping ? count + 1 : owned.size(); }
+
+		std::size_t capacity() const noexcept { return mapping ? count + 1 : owned.capacity(); }
+
+		const charT* data() const noexcept { return mapping ? mapped : owned.data(); }
+
+		const charT& operator[](std::size_t index) const noexcept { return data()[index]; }
+
+		// While mapped, the virtual terminator after the file contents.
+		const charT& back() const noexcept { return mapping ? terminator : owned.back(); }
+
+		const_iterator begin() const noexcept { return data(); }
+
+		const_iterator end() const noexcept { return data() + size(); }
+
+		charT* data() { detach(); return owned.data(); }
+
+		charT& operator[](std::size_t index) { detach(); return owned[index]; }
+
+		iterator begin() { return data(); }
+
+		iterator end() { return data() + size(); }
+
+		void push_back(const charT& value) { detach(); owned.push_back(value); }
+
+		void pop_back() { detach(); owned.pop_back(); }
+
+		void resize(std::size_t wanted) { detach(); owned.resize(wanted); }
+
+		void reserve(std::size_t wanted) { detach(); owned.reserve(wanted); }
+
+		void shrink_to_fit() { detach(); owned.shrink_to_fit(); }
+
+		void clear() noexcept { mapping.reset(); owned.clear(); }
+
+	private:
+		struct Mapping {
+			// Error codes are read right after the failing call, before any cleanup call can
+			// overwrite them.
+			explicit Mapping(const char* path) : address(nullptr), bytes(0) {
+#if defined(_WIN32)
+				HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				if (file == INVALID_HANDLE_VALUE) {
+					fail(::GetLastError(), "Cannot open file [mapped_file<charT>::mapped_file]");
+				}
+				LARGE_INTEGER length;
+				if (!::GetFileSizeEx(file, &length)) {
+					DWORD error = ::GetLastError();
+					::CloseHandle(file);
+					fail(error, "Cannot read file size [mapped_file<charT>::mapped_file]");
+				}
+				bytes = static_cast<std::size_t>(length.QuadPart);
+				DWORD error = ERROR_SUCCESS;
+				if (bytes) {
+					HANDLE view = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					if (view) {
+						address = ::MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+						if (!address) {
+							error = ::GetLastError();
+						}
+						::CloseHandle(view);
+					}
+					else {
+						error = ::GetLastError();
+					}
+				}
+				::CloseHandle(file);
+				if (bytes && !address) {
+					fail(error, "Cannot map file [mapped_file<charT>::mapped_file]");
+				}
+#else
+				int descriptor = ::open(path, O_RDONLY);
+				if (descriptor < 0) {
+					fail(errno, "Cannot open file [mapped_file<charT>::mapped_file]");
+				}
+				struct stat status;
+				if (::fstat(descriptor, &status) != 0) {
+					int error = errno;
+					::close(descriptor);
+					fail(error, "Cannot read file size [mapped_file<charT>::mapped_file]");
+				}
+				bytes = static_cast<std::size_t>(status.st_size);
+				if (bytes) {
+					address = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+				}
+				int error = errno;
+				::close(descriptor);
+				if (address == MAP_FAILED) {
+					address = nullptr;
+					fail(error, "Cannot map file [mapped_file<charT>::mapped_file]");
+				}
+#endif
+			}
+
+			Mapping(const Mapping&) = delete;
+
+			Mapping& operator=(const Mapping&) = delete;
+
+			~Mapping() {
+				if (address) {
+#if defined(_WIN32)
+					::UnmapViewOfFile(address);
+#else
+					::munmap(address, bytes);
+#endif
+				}
+			}
+
+#if defined(_WIN32)
+			[[noreturn]] static void fail(DWORD error, const char* message) {
+				throw std::system_error(static_cast<int>(error), std::system_category(), message);
+			}
+#else
+			[[noreturn]] static void fail(int error, const char* message) {
+				throw std::system_error(error, std::generic_category(), message);
+			}
+#endif
+
+			void* address;
+			std::size_t bytes;
+		};
+
+		void detach() {
+			if (mapping) {
+				owned.reserve(count + 1);
+				owned.assign(mapped, mapped + count);
+				owned.push_back(charT());
+				mapping.reset();
+				mapped = nullptr;
+			}
+		}
+
+		static constexpr charT terminator = charT();
+
+		std::shared_ptr<const Mapping> mapping;
+		const charT* mapped;
+		std::size_t count;
+		std::vector<charT> owned;
+	};
+
+	// Read-only string over the contents of a file; see mapped_file.
+	template<class charT = char>
+	universalStrign<charT, mapped_file<charT>> make_mapped_string(const char* path) {
+		return universalStrign<charT, mapped_file<charT>>(mapped_file<charT>(path));
+	}
+}
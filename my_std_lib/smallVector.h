@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <stdexcept>
+
+namespace my_std {
+
+	// Number of elements that fit the default inline buffer: 24 bytes' worth, and room for
+	// at least one element (the terminator of an empty universalStrign) for larger types.
+	template <class T>
+	inline constexpr std::size_t default_inline_capacity = sizeof(T) < 24 ? 24 / sizeof(T) : 1;
+
+	// Contiguous sequence that keeps up to N elements in an inline buffer and only goes to
+	// the heap once it outgrows it. Usable in constant expressions; memory it takes from the
+	// heap there must be released before the evaluation ends, as for std::vector.
+	template <class T, std::size_t N = default_inline_capacity<T>>
+	class small_vector {
+		static_assert(N > 0, "small_vector needs an inline capacity of at least one element");
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		constexpr small_vector() noexcept : first(inline_buffer()), count(0), storage_capacity(N) {}
+
+		constexpr small_vector(const small_vector& other) : small_vector() {
+			reserve(other.count);
+			copy_construct(other.first, other.first + other.count, first);
+			count = other.count;
+		}
+
+		constexpr small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : small_vector() {
+			take(std::move(other));
+		}
+
+		constexpr ~small_vector() {
+			clear();
+			release_heap();
+		}
+
+		constexpr small_vector& operator=(const small_vector& other) {
+			if (this != &other) {
+				clear();
+				reserve(other.count);
+				copy_construct(other.first, other.first + other.count, first);
+				count = other.count;
+			}
+			return *this;
+		}
+
+		constexpr small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+			if (this != &other) {
+				clear();
+				release_heap();
+				take(std::move(other));
+			}
+			return *this;
+		}
+
+		constexpr std::size_t size() const noexcept { return count; }
+
+		constexpr bool empty() const noexcept { return !count; }
+
+		constexpr std::size_t capacity() const noexcept { return storage_capacity; }
+
+		static constexpr std::size_t inline_capacity() noexcept { return N; }
+
+		constexpr T* data() noexcept { return first; }
+
+		constexpr const T* data() const noexcept { return first; }
+
+		constexpr T& operator[](std::size_t index) noexcept { return first[index]; }
+
+		constexpr const T& operator[](std::size_t index) const noexcept { return first[index]; }
+
+		constexpr T& back() noexcept { return first[count - 1]; }
+
+		constexpr const T& back() const noexcept { return first[count - 1]; }
+
+		constexpr iterator begin() noexcept { return first; }
+
+		constexpr iterator end() noexcept { return first + count; }
+
+		constexpr const_iterator begin() const noexcept { return first; }
+
+		constexpr const_iterator end() const noexcept { return first + count; }
+
+		constexpr void push_back(const T& value) { emplace_back(value); }
+
+		constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		template <class... Args>
+		constexpr T& emplace_back(Args&&... args) {
+			if (count == storage_capacity) {
+				// Build the element first: args may refer into the buffer about to move.
+				T temp(std::forward<Args>(args)...);
+				grow(count + 1);
+				std::construct_at(first + count, std::move(temp));
+			}
+			else {
+				std::construct_at(first + count, std::forward<Args>(args)...);
+			}
+			return first[count++];
+		}
+
+		constexpr void pop_back() noexcept {
+			std::destroy_at(first + --count);
+		}
+
+		constexpr void clear() noexcept {
+			std::destroy(first, first + count);
+			count = 0;
+		}
+
+		constexpr void resize(std::size_t wanted) {
+			if (wanted > count) {
+				reserve(wanted);
+				if (std::is_constant_evaluated()) {
+					for (T* item = first + count; item != first + wanted; item++)
+					{
+						std::construct_at(item);
+					}
+				}
+				else {
+					std::uninitialized_value_construct(first + count, first + wanted);
+				}
+			}
+			else {
+				std::destroy(first + wanted, first + count);
+			}
+			count = wanted;
+		}
+
+		constexpr void reserve(std::size_t wanted) {
+			if (wanted > storage_capacity) {
+				relocate_to(wanted);
+			}
+		}
+
+		constexpr void shrink_to_fit() {
+			if (first != inline_buffer() && count < storage_capacity) {
+				relocate_to(count);
+			}
+		}
+
+	private:
+		// Inline elements live in a union so that they are only constructed on demand, which
+		// unlike a raw byte buffer also works in constant expressions.
+		union inline_storage {
+			constexpr inline_storage() noexcept {}
+
+			constexpr ~inline_storage() {}
+
+			T items[N];
+		};
+
+		constexpr T* inline_buffer() noexcept { return buffer.items; }
+
+		// Uninitialized copy and move; the standard ones are not constexpr before C++26.
+		static constexpr void copy_construct(const T* from, const T* last, T* to) {
+			if (std::is_constant_evaluated()) {
+				for (; from != last; from++, to++)
+				{
+					std::construct_at(to, *from);
+				}
+			}
+			else {
+				std::uninitialized_copy(from, last, to);
+			}
+		}
+
+		static constexpr void move_construct(T* from, T* last, T* to) {
+			if (std::is_constant_evaluated()) {
+				for (; from != last; from++, to++)
+				{
+					std::construct_at(to, std::move(*from));
+				}
+			}
+			else {
+				std::uninitialized_move(from, last, to);
+			}
+		}
+
+		constexpr void grow(std::size_t wanted) {
+			relocate_to(std::max(wanted, storage_capacity * 2));
+		}
+
+		// Moves the elements into a buffer of exactly wanted slots, inline when they fit.
+		constexpr void relocate_to(std::size_t wanted) {
+			T* target = wanted <= N ? inline_buffer() : std::allocator<T>().allocate(wanted);
+			if (target == first) {
+				return;
+			}
+			if (std::is_trivially_copyable_v<T> && !std::is_constant_evaluated()) {
+				if (count) {
+					std::memmove(static_cast<void*>(target), first, count * sizeof(T));
+				}
+			}
+			else {
+				move_construct(first, first + count, target);
+				std::destroy(first, first + count);
+			}
+			release_heap();
+			first = target;
+			storage_capacity = wanted <= N ? N : wanted;
+		}
+
+		constexpr void release_heap() noexcept {
+			if (first != inline_buffer()) {
+				std::allocator<T>().deallocate(first, storage_capacity);
+				first = inline_buffer();
+				storage_capacity = N;
+			}
+		}
+
+		constexpr void take(small_vector&& other) {
+			if (other.first != other.inline_buffer()) {
+				first = other.first;
+				storage_capacity = other.storage_capacity;
+				count = other.count;
+				other.first = other.inline_buffer();
+				other.storage_capacity = N;
+				other.count = 0;
+			}
+			else {
+				move_construct(other.first, other.first + other.count, first);
+				count = other.count;
+				other.clear();
+			}
+		}
+
+		T* first;
+		std::size_t count;
+		std::size_t storage_capacity;
+		inline_storage buffer;
+	};
+}
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "charKernels.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace my_std {
+
+	namespace hash_detail {
+
+		inline constexpr std::uint64_t secret[4] = {
+			0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL };
+
+		// Full 64x64 -> 128-bit product, folded by xor.
+		constexpr std::uint64_t mix(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+			__extension__ unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+			return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+			if (!std::is_constant_evaluated()) {
+				std::uint64_t high;
+				std::uint64_t low = _umul128(a, b, &high);
+				return low ^ high;
+			}
+#endif
+			std::uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32, bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+			std::uint64_t lowLow = aLow * bLow, highLow = aHigh * bLow, lowHigh = aLow * bHigh, highHigh = aHigh * bHigh;
+			std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+			return ((middle << 32) | (lowLow & 0xFFFFFFFF)) ^ (highHigh + (highLow >> 32) + (middle >> 32));
+#endif
+		}
+
+		// Reads width bytes at byte offset index of the units' object representation as a
+		// native-endian integer. Constant evaluation cannot reinterpret the units as bytes,
+		// so it extracts them arithmetically in the same order memcpy would see them.
+		template <class unitT>
+		constexpr std::uint64_t read(const unitT* first, std::size_t index, std::size_t width) {
+			if (!std::is_constant_evaluated()) {
+				const unsigned char* bytes = reinterpret_cast<const unsigned char*>(first) + index;
+				if (width == 8) {
+					std::uint64_t value;
+					std::memcpy(&value, bytes, 8);
+					return value;
+				}
+				std::uint32_t value;
+				std::memcpy(&value, bytes, 4);
+				return value;
+			}
+			std::uint64_t value = 0;
+			for (std::size_t i = 0; i < width; i++)
+			{
+				std::size_t position = index + i;
+				auto unit = static_cast<std::make_unsigned_t<unitT>>(first[position / sizeof(unitT)]);
+				std::size_t byte = position % sizeof(unitT);
+				if constexpr (std::endian::native == std::endian::big) {
+					byte = sizeof(unitT) - 1 - byte;
+				}
+				std::uint64_t bits = sizeof(unitT) == 1 ? unit : static_cast<std::uint64_t>(unit) >> (8 * byte) & 0xFF;
+				if constexpr (std::endian::native == std::endian::big) {
+					value = value << 8 | bits;
+				}
+				else {
+					value |= bits << (8 * i);
+				}
+			}
+			return value;
+		}
+
+		template <class unitT>
+		constexpr std::uint64_t read_byte(const unitT* first, std::size_t index) {
+			if (!std::is_constant_evaluated()) {
+				return reinterpret_cast<const unsigned char*>(first)[index];
+			}
+			std::size_t byte = index % sizeof(unitT);
+			if constexpr (std::endian::native == std::endian::big) {
+				byte = sizeof(unitT) - 1 - byte;
+			}
+			auto unit = static_cast<std::make_unsigned_t<unitT>>(first[index / sizeof(unitT)]);
+			return sizeof(unitT) == 1 ? unit : static_cast<std::uint64_t>(unit) >> (8 * byte) & 0xFF;
+		}
+
+		// wyhash-style 64-bit hash of the count bytes that the units at first occupy. Inputs
+		// over 48 bytes run three independent multiply lanes, so the 64-bit multiplier stays
+		// busy; short inputs take one or two overlapping loads and no loop.
+		template <class unitT>
+		constexpr std::uint64_t hash_units(const unitT* first, std::size_t count, std::uint64_t seed) {
+			seed ^= mix(seed ^ secret[0], secret[1]);
+			std::uint64_t a;
+			std::uint64_t b;
+			if (count <= 16) {
+				if (count >= 4) {
+					std::size_t step = (count >> 3) << 2;
+					a = read(first, 0, 4) << 32 | read(first, step, 4);
+					b = read(first, count - 4, 4) << 32 | read(first, count - 4 - step, 4);
+				}
+				else if (count) {
+					a = read_byte(first, 0) << 16 | read_byte(first, count >> 1) << 8 | read_byte(first, count - 1);
+					b = 0;
+				}
+				else {
+					a = b = 0;
+				}
+			}
+			else {
+				std::size_t index = 0;
+				std::size_t left = count;
+				if (left > 48) {
+					std::uint64_t lane1 = seed;
+					std::uint64_t lane2 = seed;
+					do {
+						seed = mix(read(first, index, 8) ^ secret[1], read(first, index + 8, 8) ^ seed);
+						lane1 = mix(read(first, index + 16, 8) ^ secret[2], read(first, index + 24, 8) ^ lane1);
+						lane2 = mix(read(first, index + 32, 8) ^ secret[3], read(first, index + 40, 8) ^ lane2);
+						index += 48;
+						left -= 48;
+					} while (left > 48);
+					seed ^= lane1 ^ lane2;
+				}
+				while (left > 16) {
+					seed = mix(read(first, index, 8) ^ secret[1], read(first, index + 8, 8) ^ seed);
+					index += 16;
+					left -= 16;
+				}
+				a = read(first, index + left - 16, 8);
+				b = read(first, index + left - 8, 8);
+			}
+			return mix(secret[1] ^ count, mix(a ^ secret[1], b ^ seed));
+		}
+	}
+
+	// Hash of count raw bytes.
+	inline std::uint64_t hash_bytes(const void* data, std::size_t count, std::uint64_t seed = 0) {
+		return hash_detail::hash_units(static_cast<const unsigned char*>(data), count, seed);
+	}
+
+	// Hash of count characters, the same in constant expressions as at run time. Integral
+	// characters are hashed as bytes; other types, such as nested universalStrign, fold their
+	// own std::hash values.
+	template <class charT>
+	constexpr std::size_t hash_chars(const charT* first, std::size_t count) {
+		if constexpr (is_bitwise_comparable<charT>) {
+			return static_cast<std::size_t>(hash_detail::hash_units(first, count * sizeof(charT), 0));
+		}
+		else {
+			std::uint64_t seed = hash_detail::secret[0];
+			for (std::size_t i = 0; i < count; i++)
+			{
+				seed = hash_detail::mix(seed ^ std::hash<charT>()(first[i]), hash_detail::secret[1]);
+			}
+			return static_cast<std::size_t>(hash_detail::mix(seed ^ count, hash_detail::secret[2]));
+		}
+	}
+
+	// Container adapter for universalStrign that remembers the hash of its characters, so a
+	// string used as a key repeatedly is hashed once. Any non-const access, which is how every
+	// mutation of the string (push_back, transform, operator[], ...) reaches its container,
+	// forgets the hash; do not write through a reference taken before the hash was cached.
+	// Zero marks no cached hash, so a string whose hash is zero is simply rehashed.
+	template <class Container>
+	class hash_caching {
+	public:
+		using value_type = typename Container::value_type;
+		using size_type = std::size_t;
+		using iterator = typename Container::iterator;
+		using const_iterator = typename Container::const_iterator;
+
+		hash_caching() = default;
+
+		hash_caching(const hash_caching& other) : items(other.items), hash_value(other.cached_hash()) {}
+
+		hash_caching(hash_caching&& other) noexcept(std::is_nothrow_move_constructible_v<Container>)
+			: items(std::move(other.items)), hash_value(other.hash_value.exchange(0, std::memory_order_relaxed)) {}
+
+		hash_caching& operator=(const hash_caching& other) {
+			items = other.items;
+			remember_hash(other.cached_hash());
+			return *this;
+		}
+
+		hash_caching& operator=(hash_caching&& other) noexcept(std::is_nothrow_move_assignable_v<Container>) {
+			items = std::move(other.items);
+			remember_hash(other.hash_value.exchange(0, std::memory_order_relaxed));
+			return *this;
+		}
+
+		std::size_t cached_hash() const noexcept { return hash_value.load(std::memory_order_relaxed); }
+
+		void remember_hash(std::size_t value) const noexcept { hash_value.store(value, std::memory_order_relaxed); }
+
+		std::size_t size() const noexcept { return items.size(); }
+
+		std::size_t capacity() const noexcept { return items.capacity(); }
+
+		const value_type* data() const noexcept { return items.data(); }
+
+		const value_type& operator[](std::size_t index) const noexcept { return items[index]; }
+
+		const value_type& back() const noexcept { return items.back(); }
+
+		const_iterator begin() const noexcept { return items.begin(); }
+
+		const_iterator end() const noexcept { return items.end(); }
+
+		value_type* data() { forget(); return items.data(); }
+
+		value_type& operator[](std::size_t index) { forget(); return items[index]; }
+
+		iterator begin() { forget(); return items.begin(); }
+
+		iterator end() { forget(); return items.end(); }
+
+		void push_back(const value_type& value) { forget(); items.push_back(value); }
+
+		void pop_back() { forget(); items.pop_back(); }
+
+		void resize(std::size_t wanted) { forget(); items.resize(wanted); }
+
+		void reserve(std::size_t wanted) { items.reserve(wanted); }
+
+		void shrink_to_fit() { items.shrink_to_fit(); }
+
+		void clear() { forget(); items.clear(); }
+
+	private:
+		void forget() noexcept { hash_value.store(0, std::memory_order_relaxed); }
+
+		Container items;
+		mutable std::atomic<std::size_t> hash_value{ 0 };
+	};
+}
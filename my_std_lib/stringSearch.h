@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include "charKernels.h"
+
+namespace my_std {
+
+	// Index of the first value in [first, first + size), or npos (size_t(-1)).
+	template <class charT>
+	std::size_t find_char(const charT* first, std::size_t size, const charT& value) {
+		if constexpr (sizeof(charT) == 1 && is_bitwise_comparable<charT>) {
+			const void* hit = size ? std::memchr(first, static_cast<unsigned char>(value), size) : nullptr;
+			return hit ? static_cast<const charT*>(hit) - first : static_cast<std::size_t>(-1);
+		}
+		else {
+			const charT* hit = std::find(first, first + size, value);
+			return hit != first + size ? hit - first : static_cast<std::size_t>(-1);
+		}
+	}
+
+	// Index of the first character at or after from that is one of set, or npos.
+	template <class charT>
+	std::size_t find_first_of_chars(const charT* first, std::size_t size, const charT* set, std::size_t setSize, std::size_t from = 0) {
+		if constexpr (sizeof(charT) == 1 && is_bitwise_comparable<charT>) {
+			bool member[256] = {};
+			for (std::size_t i = 0; i < setSize; i++)
+			{
+				member[static_cast<unsigned char>(set[i])] = true;
+			}
+			for (std::size_t i = from; i < size; i++)
+			{
+				if (member[static_cast<unsigned char>(first[i])]) {
+					return i;
+				}
+			}
+		}
+		else {
+			for (std::size_t i = from; i < size; i++)
+			{
+				if (std::find(set, set + setSize, first[i]) != set + setSize) {
+					return i;
+				}
+			}
+		}
+		return static_cast<std::size_t>(-1);
+	}
+
+	// A needle prepared once and searched for in any number of haystacks. Like the standard
+	// searchers it does not copy the needle, which must outlive it.
+	//
+	// One-character needles go to find_char (memchr for bytes). Byte needles shorter than
+	// 256 use a filter that tests the first and last needle character against 16 (SSE2) or
+	// 32 (AVX2) positions at once. Longer needles, and needles of 16 or more wider integral
+	// characters, use Boyer-Moore-Horspool. Everything else filters on the first character.
+	template <class charT>
+	class searcher {
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		searcher(const charT* Needle, std::size_t size) : needle(Needle), needle_size(size), horspool(false) {
+			if constexpr (is_bitwise_comparable<charT>) {
+				if (needle_size >= (sizeof(charT) == 1 ? 256 : 16)) {
+					// Shifts are capped at 255 to keep the table small; a shorter shift
+					// never skips a match.
+					horspool = true;
+					shifts.fill(static_cast<unsigned char>(std::min<std::size_t>(needle_size, 255)));
+					for (std::size_t i = 0; i + 1 < needle_size; i++)
+					{
+						shifts[bucket(needle[i])] = static_cast<unsigned char>(std::min<std::size_t>(needle_size - 1 - i, 255));
+					}
+				}
+			}
+		}
+
+		std::size_t size() const noexcept { return needle_size; }
+
+		std::size_t find(const charT* haystack, std::size_t size, std::size_t from = 0) const {
+			if (from > size || needle_size > size - from) {
+				return npos;
+			}
+			if (!needle_size) {
+				return from;
+			}
+			if (needle_size == 1) {
+				std::size_t hit = find_char(haystack + from, size - from, needle[0]);
+				return hit == npos ? npos : from + hit;
+			}
+			if constexpr (is_bitwise_comparable<charT>) {
+				if (horspool) {
+					return find_horspool(haystack, size, from);
+				}
+			}
+#if defined(MY_STD_SSE2)
+			if constexpr (sizeof(charT) == 1 && is_bitwise_comparable<charT>) {
+				return find_filtered(haystack, size, from);
+			}
+#endif
+			for (std::size_t position = from; position + needle_size <= size; position++)
+			{
+				std::size_t hit = find_char(haystack + position, size - needle_size + 1 - position, needle[0]);
+				if (hit == npos) {
+					return npos;
+				}
+				position += hit;
+				if (equal_chars(haystack + position + 1, needle + 1, needle_size - 1)) {
+					return position;
+				}
+			}
+			return npos;
+		}
+
+		// Last match starting at or before from.
+		std::size_t rfind(const charT* haystack, std::size_t size, std::size_t from = npos) const {
+			if (needle_size > size) {
+				return npos;
+			}
+			std::size_t position = std::min(from, size - needle_size);
+			for (;; position--)
+			{
+				if (!needle_size || (haystack[position] == needle[0]
+					&& equal_chars(haystack + position + 1, needle + 1, needle_size - 1))) {
+					return position;
+				}
+				if (!position) {
+					return npos;
+				}
+			}
+		}
+
+		// Non-overlapping matches; an empty needle matches nothing.
+		std::size_t count(const charT* haystack, std::size_t size) const {
+			if (!needle_size) {
+				return 0;
+			}
+			std::size_t result = 0;
+			for (std::size_t position = find(haystack, size); position != npos; position = find(haystack, size, position + needle_size))
+			{
+				result++;
+			}
+			return result;
+		}
+
+	private:
+		static std::size_t bucket(const charT& value) {
+			return static_cast<std::size_t>(static_cast<std::make_unsigned_t<charT>>(value) & 0xFF);
+		}
+
+		std::size_t find_horspool(const charT* haystack, std::size_t size, std::size_t from) const {
+			// Wider characters share buckets by their low byte, and each bucket keeps the
+			// smallest shift of its members, so no match is skipped.
+			const charT last = needle[needle_size - 1];
+			for (std::size_t position = from; position + needle_size <= size;)
+			{
+				const charT& tail = haystack[position + needle_size - 1];
+				if (tail == last && equal_chars(haystack + position, needle, needle_size - 1)) {
+					return position;
+				}
+				position += shifts[bucket(tail)];
+			}
+			return npos;
+		}
+
+#if defined(MY_STD_SSE2)
+		std::size_t find_filtered(const charT* haystack, std::size_t size, std::size_t from) const {
+			const __m128i first = _mm_set1_epi8(static_cast<char>(needle[0]));
+			const __m128i last = _mm_set1_epi8(static_cast<char>(needle[needle_size - 1]));
+			std::size_t position = from;
+#if defined(MY_STD_AVX2)
+			const __m256i wideFirst = _mm256_set1_epi8(static_cast<char>(needle[0]));
+			const __m256i wideLast = _mm256_set1_epi8(static_cast<char>(needle[needle_size - 1]));
+			for (; position + needle_size - 1 + 32 <= size; position += 32)
+			{
+				__m256i heads = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + position));
+				__m256i tails = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + position + needle_size - 1));
+				unsigned candidates = static_cast<unsigned>(_mm256_movemask_epi8(
+					_mm256_and_si256(_mm256_cmpeq_epi8(heads, wideFirst), _mm256_cmpeq_epi8(tails, wideLast))));
+				while (candidates) {
+					std::size_t hit = position + std::countr_zero(candidates);
+					if (equal_chars(haystack + hit + 1, needle + 1, needle_size - 2)) {
+						return hit;
+					}
+					candidates &= candidates - 1;
+				}
+			}
+#endif
+			for (; position + needle_size - 1 + 16 <= size; position += 16)
+			{
+				__m128i heads = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + position));
+				__m128i tails = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + position + needle_size - 1));
+				unsigned candidates = static_cast<unsigned>(_mm_movemask_epi8(
+					_mm_and_si128(_mm_cmpeq_epi8(heads, first), _mm_cmpeq_epi8(tails, last))));
+				while (candidates) {
+					std::size_t hit = position + std::countr_zero(candidates);
+					if (equal_chars(haystack + hit + 1, needle + 1, needle_size - 2)) {
+						return hit;
+					}
+					candidates &= candidates - 1;
+				}
+			}
+			for (; position + needle_size <= size; position++)
+			{
+				if (haystack[position] == needle[0] && equal_chars(haystack + position + 1, needle + 1, needle_size - 1)) {
+					return position;
+				}
+			}
+			return npos;
+		}
+#endif
+
+		const charT* needle;
+		std::size_t needle_size;
+		bool horspool;
+		// Filled only when horspool is chosen; short needles never touch it.
+		std::array<unsigned char, 256> shifts;
+	};
+}
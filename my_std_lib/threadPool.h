@@ -0,0 +1,88 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+namespace my_std {
+
+	// Fixed set of worker threads fed from one FIFO queue. Tasks must not block waiting
+	// for other tasks of the same pool.
+	class thread_pool {
+	public:
+		explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency()) : stopping(false) {
+			if (!threads) {
+				threads = 1;
+			}
+			for (std::size_t i = 0; i < threads; i++)
+			{
+				workers.emplace_back([this] { work(); });
+			}
+		}
+
+		thread_pool(const thread_pool&) = delete;
+
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		~thread_pool() {
+			{
+				std::lock_guard<std::mutex> lock(guard);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto& worker : workers) {
+				worker.join();
+			}
+		}
+
+		std::size_t size() const { return workers.size(); }
+
+		template <class Task>
+		std::future<std::invoke_result_t<Task>> submit(Task task) {
+			using result_type = std::invoke_result_t<Task>;
+			auto packaged = std::make_shared<std::packaged_task<result_type()>>(std::move(task));
+			auto result = packaged->get_future();
+			{
+				std::lock_guard<std::mutex> lock(guard);
+				tasks.emplace([packaged] { (*packaged)(); });
+			}
+			wake.notify_one();
+			return result;
+		}
+
+		// Process-wide pool sized to the hardware, created on first use.
+		static thread_pool& shared() {
+			static thread_pool instance;
+			return instance;
+		}
+
+	private:
+		void work() {
+			for (;;) {
+				std::function<void()> task;
+				{
+					std::unique_lock<std::mutex> lock(guard);
+					wake.wait(lock, [this] { return stopping || !tasks.empty(); });
+					if (tasks.empty()) {
+						return;
+					}
+					task = std::move(tasks.front());
+					tasks.pop();
+				}
+				task();
+			}
+		}
+
+		std::vector<std::thread> workers;
+		std::queue<std::function<void()>> tasks;
+		std::mutex guard;
+		std::condition_variable wake;
+		bool stopping;
+	};
+}
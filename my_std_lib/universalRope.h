@@ -0,0 +1,347 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "universalString.h"
+
+namespace my_std {
+
+	// Sequence of characters kept as a height-balanced (AVL) tree of shared universalStrign
+	// chunks, for documents assembled from many pieces. Concatenation and split copy no
+	// characters and take O(log n); copies of a rope share every node, which is never
+	// changed while shared. Adjacent leaves of at most short_leaf characters are merged as
+	// they are joined, so building from small fragments does not leave a node per fragment.
+	template <class charT>
+	class universalRope {
+		struct node;
+		using node_ptr = std::shared_ptr<const node>;
+
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		static constexpr std::size_t short_leaf = 256;
+
+		// Walks the characters leaf by leaf. Valid until the rope it came from is changed or
+		// destroyed.
+		class const_iterator {
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = charT;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const charT*;
+			using reference = const charT&;
+
+			const_iterator() noexcept : current(nullptr), leafEnd(nullptr) {}
+
+			reference operator*() const noexcept { return *current; }
+
+			pointer operator->() const noexcept { return current; }
+
+			const_iterator& operator++() {
+				if (++current == leafEnd) {
+					next_leaf();
+				}
+				return *this;
+			}
+
+			const_iterator operator++(int) {
+				const_iterator result = *this;
+				++*this;
+				return result;
+			}
+
+			friend bool operator==(const const_iterator& iterator1, const const_iterator& iterator2) noexcept {
+				return iterator1.current == iterator2.current;
+			}
+
+		private:
+			friend class universalRope;
+
+			explicit const_iterator(const node* root) : current(nullptr), leafEnd(nullptr) { descend(root); }
+
+			void descend(const node* item) {
+				while (item && !item->is_leaf()) {
+					pending.push_back(item->right.get());
+					item = item->left.get();
+				}
+				if (item) {
+					current = item->chars;
+					leafEnd = item->chars + item->size;
+				}
+			}
+
+			void next_leaf() {
+				current = nullptr;
+				leafEnd = nullptr;
+				if (!pending.empty()) {
+					const node* item = pending.back();
+					pending.pop_back();
+					descend(item);
+				}
+			}
+
+			// Right subtrees still to visit, innermost last.
+			small_vector<const node*, 32> pending;
+			const charT* current;
+			const charT* leafEnd;
+		};
+
+		universalRope() noexcept = default;
+
+		universalRope(universalStrign<charT> text) : root(make_leaf(std::move(text))) {}
+
+		universalRope(const charT* Array) : universalRope(universalStrign<charT>(Array)) {}
+
+		explicit universalRope(universalStrign_view<charT> view) : universalRope(universalStrign<charT>(view)) {}
+
+		std::size_t size() const noexcept { return root ? root->size : 0; }
+
+		bool isEmpty() const noexcept { return !root; }
+
+		// O(log n).
+		charT operator[](std::size_t index) const {
+			if (index >= size()) {
+				throw std::out_of_range("Out of range error [universalRope<charT>::operator[]]");
+			}
+			const node* item = root.get();
+			while (!item->is_leaf()) {
+				if (index < item->left->size) {
+					item = item->left.get();
+				}
+				else {
+					index -= item->left->size;
+					item = item->right.get();
+				}
+			}
+			return item->chars[index];
+		}
+
+		const_iterator begin() const { return const_iterator(root.get()); }
+
+		const_iterator end() const noexcept { return const_iterator(); }
+
+		void append(const universalRope& other) {
+			if (!other.root || !other.root->is_leaf() || !append_in_place(other.root->chars, other.root->size)) {
+				root = join(root, other.root);
+			}
+		}
+
+		// Copies the characters in; short runs usually land in the last leaf.
+		void append(universalStrign_view<charT> text) {
+			if (!append_in_place(text.data(), text.size())) {
+				root = join(root, make_leaf(universalStrign<charT>(text)));
+			}
+		}
+
+		void append(const universalStrign<charT>& text) { append(universalStrign_view<charT>(text)); }
+
+		void append(const charT* Array) { append(universalStrign_view<charT>(Array)); }
+
+		friend universalRope operator+(const universalRope& rope1, const universalRope& rope2) {
+			return universalRope(join(rope1.root, rope2.root));
+		}
+
+		// Characters from index to the end, like universalStrign::split.
+		universalRope split(std::size_t index) const {
+			if (index >= size()) {
+				throw std::out_of_range("Out of range error [universalRope<charT> universalRope<charT>::split]");
+			}
+			return universalRope(drop_front(root, index));
+		}
+
+		// Characters [index, index + count), clipped to the end of the rope.
+		universalRope substr(std::size_t index, std::size_t count = npos) const {
+			if (index > size()) {
+				throw std::out_of_range("Out of range error [universalRope<charT>::substr]");
+			}
+			return universalRope(take_front(drop_front(root, index), std::min(count, size() - index)));
+		}
+
+		// Calls visit(universalStrign_view<charT>) for each leaf, in order.
+		template <class Visitor>
+		void for_each_chunk(Visitor visit) const {
+			for_each_chunk(root.get(), visit);
+		}
+
+		// Copies the characters into one contiguous string, allocated once.
+		universalStrign<charT> flatten() const {
+			auto result = universalStrign<charT>();
+			result.reserve(size());
+			for_each_chunk([&result](universalStrign_view<charT> chunk) { result.append(chunk.data(), chunk.size()); });
+			return result;
+		}
+
+		template <class streamCharT, class Traits>
+		friend std::basic_ostream<streamCharT, Traits>& operator<<(std::basic_ostream<streamCharT, Traits>& out, const universalRope& rope) {
+			rope.for_each_chunk([&out](universalStrign_view<charT> chunk) { out << chunk; });
+			return out;
+		}
+
+	private:
+		// A leaf points into a chunk it shares with the leaves sliced from it; an inner node
+		// concatenates left and right.
+		struct node {
+			std::size_t size;
+			unsigned height;
+			node_ptr left;
+			node_ptr right;
+			std::shared_ptr<universalStrign<charT>> chunk;
+			const charT* chars;
+
+			bool is_leaf() const noexcept { return !left; }
+		};
+
+		explicit universalRope(node_ptr Root) : root(std::move(Root)) {}
+
+		static unsigned height(const node_ptr& item) noexcept { return item ? item->height : 0; }
+
+		static node_ptr make_leaf(universalStrign<charT> text) {
+			if (text.isEmpty()) {
+				return nullptr;
+			}
+			auto chunk = std::make_shared<universalStrign<charT>>(std::move(text));
+			const charT* chars = universalStrign_view<charT>(*chunk).data();
+			return std::make_shared<node>(node{ chunk->size(), 0, nullptr, nullptr, std::move(chunk), chars });
+		}
+
+		static node_ptr make_slice(const node_ptr& leaf, std::size_t index, std::size_t count) {
+			if (!count) {
+				return nullptr;
+			}
+			if (count == leaf->size) {
+				return leaf;
+			}
+			return std::make_shared<node>(node{ count, 0, nullptr, nullptr, leaf->chunk, leaf->chars + index });
+		}
+
+		static node_ptr make_inner(node_ptr left, node_ptr right) {
+			std::size_t size = left->size + right->size;
+			unsigned height = std::max(left->height, right->height) + 1;
+			return std::make_shared<node>(node{ size, height, std::move(left), std::move(right), nullptr, nullptr });
+		}
+
+		// Inner node over subtrees whose heights differ by at most two.
+		static node_ptr balance(node_ptr left, node_ptr right) {
+			if (height(left) > height(right) + 1) {
+				if (height(left->left) >= height(left->right)) {
+					return make_inner(left->left, make_inner(left->right, std::move(right)));
+				}
+				return make_inner(make_inner(left->left, left->right->left), make_inner(left->right->right, std::move(right)));
+			}
+			if (height(right) > height(left) + 1) {
+				if (height(right->right) >= height(right->left)) {
+					return make_inner(make_inner(std::move(left), right->left), right->right);
+				}
+				return make_inner(make_inner(std::move(left), right->left->left), make_inner(right->left->right, right->right));
+			}
+			return make_inner(std::move(left), std::move(right));
+		}
+
+		// Concatenation in O(|height(left) - height(right)|): the shorter tree is joined in
+		// along the facing spine of the taller one.
+		static node_ptr join(const node_ptr& left, const node_ptr& right) {
+			if (!left) {
+				return right;
+			}
+			if (!right) {
+				return left;
+			}
+			if (left->height > right->height + 1) {
+				return balance(left->left, join(left->right, right));
+			}
+			if (right->height > left->height + 1) {
+				return balance(join(left, right->left), right->right);
+			}
+			if (left->is_leaf() && right->is_leaf() && left->size + right->size <= short_leaf) {
+				auto text = universalStrign<charT>();
+				text.reserve(short_leaf);
+				text.append(left->chars, left->size);
+				text.append(right->chars, right->size);
+				return make_leaf(std::move(text));
+			}
+			return make_inner(left, right);
+		}
+
+		// Appends to the last leaf without copying the path to it, when this rope is the only
+		// owner of that path and of the leaf's chunk, the leaf ends where the chunk does and it
+		// stays short. Nodes are created non-const, so changing an unshared one is sound.
+		bool append_in_place(const charT* chars, std::size_t count) {
+			if (!root || !count || count > short_leaf) {
+				return false;
+			}
+			small_vector<node*, 32> spine;
+			for (const node_ptr* item = &root;; item = &(*item)->right)
+			{
+				if (item->use_count() != 1) {
+					return false;
+				}
+				spine.push_back(const_cast<node*>(item->get()));
+				if ((*item)->is_leaf()) {
+					break;
+				}
+			}
+			node* leaf = spine.back();
+			if (leaf->chunk.use_count() != 1 || leaf->size + count > short_leaf) {
+				return false;
+			}
+			universalStrign<charT>& text = *leaf->chunk;
+			const charT* first = universalStrign_view<charT>(text).data();
+			if (leaf->chars + leaf->size != first + text.size()) {
+				return false;
+			}
+			std::size_t offset = leaf->chars - first;
+			text.append(chars, count);
+			leaf->chars = universalStrign_view<charT>(text).data() + offset;
+			for (node* item : spine) {
+				item->size += count;
+			}
+			return true;
+		}
+
+		static node_ptr drop_front(const node_ptr& item, std::size_t count) {
+			if (!count || !item) {
+				return item;
+			}
+			if (count >= item->size) {
+				return nullptr;
+			}
+			if (item->is_leaf()) {
+				return make_slice(item, count, item->size - count);
+			}
+			if (count >= item->left->size) {
+				return drop_front(item->right, count - item->left->size);
+			}
+			return join(drop_front(item->left, count), item->right);
+		}
+
+		static node_ptr take_front(const node_ptr& item, std::size_t count) {
+			if (!item || count >= item->size) {
+				return item;
+			}
+			if (item->is_leaf()) {
+				return make_slice(item, 0, count);
+			}
+			if (count <= item->left->size) {
+				return take_front(item->left, count);
+			}
+			return join(item->left, take_front(item->right, count - item->left->size));
+		}
+
+		template <class Visitor>
+		static void for_each_chunk(const node* item, Visitor& visit) {
+			for (; item && !item->is_leaf(); item = item->right.get())
+			{
+				for_each_chunk(item->left.get(), visit);
+			}
+			if (item) {
+				visit(universalStrign_view<charT>(item->chars, item->size));
+			}
+		}
+
+		node_ptr root;
+	};
+}
@@ -6,17 +6,65 @@
 #include <concepts>
 #include <functional>
 #include <string>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <exception>
+#include <cerrno>
+#include <climits>
+#include <iterator>
+#include <istream>
+#include <ostream>
+#include <locale>
+#include <system_error>
 #include "framework.h"
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "smallVector.h"
+#include "universalStringView.h"
+#include "fixedString.h"
+#include "stringHash.h"
+#include "utfConversion.h"
+#include "threadPool.h"
 
 namespace my_std {
 
 	template <class charT>
-	using DefaultContainer = std::vector<charT>;
+	using DefaultContainer = small_vector<charT>;
+
+	// Container for strings used as hash keys again and again; see hash_caching.
+	template <class charT>
+	using HashCachingContainer = hash_caching<DefaultContainer<charT>>;
 
 	template <class value>
 	class ITransformer {
 	public:
 		virtual value operator()(value) = 0;
+
+		// Transforms count values from first into out (which may be first) with one virtual
+		// call for the whole block. Override it, or derive from blockTransformer, to avoid a
+		// virtual call per value.
+		virtual void transform_block(const value* first, value* out, std::size_t count) {
+			for (std::size_t i = 0; i < count; i++)
+			{
+				out[i] = operator()(first[i]);
+			}
+		}
+	};
+
+	// Base for dynamic transformers whose block loop calls Derived::operator() directly, so
+	// the compiler can inline and vectorize it.
+	template <class Derived, class value>
+	class blockTransformer : public ITransformer<value> {
+	public:
+		void transform_block(const value* first, value* out, std::size_t count) override {
+			Derived& self = static_cast<Derived&>(*this);
+			auto direct = [&self](value item) { return self.Derived::operator()(item); };
+			transform_chars(first, out, count, direct);
+		}
 	};
 
 	template <class charT, class Container = DefaultContainer<charT>>
@@ -32,319 +80,772 @@ namespace my_std {
 			value operator()(value val) override { return _functor(val); }
 		};
 
-		bool static Comparator(universalStrign<charT>& str1, universalStrign<charT>& str2,
-			std::function<bool(charT, charT)> predicat) {
-			std::size_t size = std::min(str1.size(), str2.size()) + 1;
-			for (size_t i = 0; i < size; i++)
-			{
-				if (!predicat(str1.data[i], str2.data[i])) {
-					return false;
-				}
+	public:
+		static constexpr std::size_t npos = universalStrign_view<charT>::npos;
+
+		constexpr universalStrign() : _offset(0), _size(0), data() { data.push_back(charT()); }
+
+		constexpr universalStrign(charT value) : universalStrign() { 
+			universalStrign::push_back(value);
+		}
+
+		[[maybe_unused]] constexpr universalStrign(std::size_t size, charT value = charT()) : _offset(0), _size(size), data() {
+			if (size == npos) {
+				throw std::length_error("Length error [universalStrign<charT>::universalStrign]");
 			}
-			return true;
+			data.resize(size + 1);
+			std::fill(data.begin(), data.begin() + size, value);
 		}
 
-	public:
-		universalStrign() : _size(0), data() { data.push_back(charT()); }
+		constexpr universalStrign(const universalStrign&) = default;
 
-		universalStrign(charT value) : universalStrign() { 
-			universalStrign::push_back(value);
+		constexpr universalStrign(universalStrign&&) noexcept;
+
+		constexpr universalStrign(const charT*);
+
+		constexpr universalStrign(const charT*, const charT*);
+
+		// Copies the viewed characters; views only become owning strings on request.
+		constexpr explicit universalStrign(universalStrign_view<charT> view) : universalStrign() { append(view.data(), view.size()); }
+
+		// Adopts storage holding the characters, such as a mapped_file (mappedFile.h). A
+		// terminator is appended unless the storage already ends with one.
+		constexpr explicit universalStrign(Container storage) : _offset(0), _size(0), data(std::move(storage)) {
+			if (!data.size() || std::as_const(data).back() != charT()) {
+				data.push_back(charT());
+			}
+			_size = data.size() - 1;
 		}
 
-		[[maybe_unused]] universalStrign(std::size_t size, charT value = charT()) : universalStrign() {
-			for (std::size_t i = 0; i < size; i++)
-			{
-				universalStrign<charT>::push_back(value);
+		constexpr universalStrign& operator=(const universalStrign&) = default;
+
+		constexpr universalStrign& operator=(universalStrign&&) noexcept;
+
+		constexpr ~universalStrign() = default;
+
+		constexpr std::size_t size() const { return _size; }
+
+		constexpr bool isEmpty() const { return !_size; }
+
+		// Characters that fit without reallocating.
+		constexpr std::size_t capacity() const { return data.capacity() ? data.capacity() - _offset - 1 : 0; }
+
+		constexpr void reserve(std::size_t size) {
+			if (size > capacity()) {
+				data.reserve(_offset + size + 1);
 			}
 		}
 
-		universalStrign(universalStrign&) = default;
+		constexpr void shrink_to_fit() {
+			if (_offset) {
+				compact();
+			}
+			data.shrink_to_fit();
+		}
+
+		constexpr void append(const charT*, std::size_t);
+
+		constexpr void append(const universalStrign& other) { append(other.chars(), other._size); }
+
+		constexpr operator universalStrign_view<charT>() const { return universalStrign_view<charT>(chars(), _size); }
+
+		constexpr universalStrign_view<charT> substr_view(std::size_t index, std::size_t count = universalStrign_view<charT>::npos) const {
+			return universalStrign_view<charT>(*this).substr_view(index, count);
+		}
+
+		// Searches, forwarded to universalStrign_view.
+		std::size_t find(universalStrign_view<charT> needle, std::size_t from = 0) const { return view().find(needle, from); }
+
+		std::size_t find(const charT& value, std::size_t from = 0) const { return view().find(value, from); }
 
-		universalStrign(universalStrign&&) noexcept;
+		std::size_t find(const searcher<charT>& needle, std::size_t from = 0) const { return view().find(needle, from); }
 
-		universalStrign(const charT*);
+		std::size_t rfind(universalStrign_view<charT> needle, std::size_t from = npos) const { return view().rfind(needle, from); }
 
-		universalStrign(const charT*, const charT*);
+		std::size_t rfind(const charT& value, std::size_t from = npos) const { return view().rfind(value, from); }
 
-		template <class OtherCharT>
-		universalStrign(universalStrign<OtherCharT>&);
+		bool contains(universalStrign_view<charT> needle) const { return view().contains(needle); }
 
-		universalStrign& operator=(universalStrign&) = default;
+		bool contains(const charT& value) const { return view().contains(value); }
 
-		universalStrign operator=(universalStrign&&) noexcept;
+		std::size_t find_first_of(universalStrign_view<charT> set, std::size_t from = 0) const { return view().find_first_of(set, from); }
 
-		~universalStrign() { clear(); }
+		std::size_t count(universalStrign_view<charT> needle) const { return view().count(needle); }
 
-		std::size_t size() const { return _size; }
+		std::size_t count(const charT& value) const { return view().count(value); }
 
-		bool isEmpty() const  { return !_size; }
+		constexpr void pop_front();
 
-		void pop_front();
+		constexpr void pop_back();
 
-		void pop_back();
+		constexpr void push_back(charT);
 
-		void push_back(charT);
+		constexpr void push_back(const universalStrign&);
 
-		void push_back(const universalStrign&);
+		constexpr void push_front(charT);
 
-		void push_front(charT);
+		constexpr void clear() { data.clear(); data.push_back(charT()); _offset = 0; _size = 0; }
 
-		void clear() { data.clear(); _size = 0; }
+		constexpr charT& operator[](std::size_t);
 
-		charT& operator[](std::size_t);
+		constexpr charT operator[](std::size_t) const;
 
-		charT operator[](std::size_t) const;
+		constexpr universalStrign split(std::size_t index) const {
+			return universalStrign(split_view(index));
+		}
 
-		universalStrign split(std::size_t index) const {
+		// Same suffix as split, without copying it.
+		constexpr universalStrign_view<charT> split_view(std::size_t index) const {
 			if (index < _size) {
-				auto result = universalStrign<charT>();
-				for (size_t i = index; i < _size; i++)
-				{
-					result.push_back(data[i]);
-				}
-				return universalStrign(result);
+				return universalStrign_view<charT>(chars() + index, _size - index);
 			}
 			else {
 				throw std::out_of_range("Out of range error [universalStrign<charT> universalStrign<charT>::split]");
 			}
 		}
 		
-		friend universalStrign operator+(universalStrign string1, universalStrign string2) {
-			auto result = universalStrign<charT>();
-			for (size_t i = 0; i < string1.size(); i++)
-			{
-				result.push_back(string1[i]);
-			}
-			for (size_t i = 0; i < string2.size(); i++)
+		friend constexpr universalStrign operator+(const universalStrign& string1, const universalStrign& string2) {
+			auto result = universalStrign();
+			result.reserve(string1.size() + string2.size());
+			result.append(string1);
+			result.append(string2);
+			return result;
+		}
+
+		friend constexpr universalStrign operator*(const universalStrign& string, std::size_t times) {
+			auto result = universalStrign();
+			result.reserve(string.size() * times);
+			for (size_t i = 0; i < times; i++)
 			{
-				result.push_back(string2[i]);
+				result.append(string);
 			}
-			return universalStrign(result);
+			return result;
 		}
 
-		friend universalStrign operator*(universalStrign string, std::size_t times) {
-			auto result = string;
-
-			for (size_t i = 0; i < times - 1; i++)
-			{
-				result.push_back(string);
+		// Hash of the characters, equal to the hash of a view of them. Containers that can
+		// remember it, such as hash_caching, compute it once per change.
+		constexpr std::size_t hash() const {
+			if constexpr (requires { data.cached_hash(); }) {
+				std::size_t value = data.cached_hash();
+				if (!value) {
+					value = hash_chars(chars(), _size);
+					data.remember_hash(value);
+				}
+				return value;
+			}
+			else {
+				return hash_chars(chars(), _size);
 			}
-			return universalStrign(result);
 		}
 
-		friend bool operator==(universalStrign& string1, universalStrign& string2) {
-			auto equal = [](charT val1, charT val2)->bool { return val1 == val2; };
-			return universalStrign<charT>::Comparator(string1, string2, equal);
+		// Lengths are checked first; the characters go through the block kernels of
+		// charKernels.h. Ordering is lexicographic with a proper prefix ordered first.
+		friend constexpr bool operator==(const universalStrign& string1, const universalStrign& string2) {
+			return string1._size == string2._size && equal_chars(string1.chars(), string2.chars(), string1._size);
 		}
 
-		friend bool operator!=(universalStrign& string1, universalStrign& string2) {
+		friend constexpr bool operator!=(const universalStrign& string1, const universalStrign& string2) {
 			return !operator==(string1, string2);
 		}
 
-		friend bool operator>=(universalStrign& string1, universalStrign& string2) {
-			auto bigger_or_equal = [](charT val1, charT val2)->bool { return val1 >= val2; };
-			return universalStrign<charT>::Comparator(string1, string2, bigger_or_equal);
+		friend constexpr bool operator<(const universalStrign& string1, const universalStrign& string2) {
+			return compare_chars(string1.chars(), string1._size, string2.chars(), string2._size) < 0;
 		}
 
-		friend bool operator>(universalStrign& string1, universalStrign& string2) {
-			return operator>=(string1, string2) && operator!=(string1, string2);
+		friend constexpr bool operator>(const universalStrign& string1, const universalStrign& string2) {
+			return operator<(string2, string1);
 		}
 
-		friend bool operator<=(universalStrign& string1, universalStrign& string2) {
-			return !operator>(string1, string2);
+		friend constexpr bool operator<=(const universalStrign& string1, const universalStrign& string2) {
+			return !operator<(string2, string1);
 		}
 
-		friend bool operator<(universalStrign& string1, universalStrign& string2) {
-			return !operator>=(string1, string2);
+		friend constexpr bool operator>=(const universalStrign& string1, const universalStrign& string2) {
+			return !operator<(string1, string2);
 		}
 
+		// Built-in block transforms (ascii_upper, ascii_lower, add_bytes, xor_bytes,
+		// lookup_table) are in charKernels.h.
 		template <class Functor = defaultTransformer<charT>>
-		void transform(Functor functor = Functor()) {
-			for (size_t i = 0; i < _size; i++)
-			{
-				data[i] = functor(data[i]);
-			}
+		constexpr void transform(Functor functor = Functor()) {
+			transform_chars(chars(), chars(), _size, functor);
 		}
 
 		void transformDyn(ITransformer<charT>* functor) {
-			for (size_t i = 0; i < _size; i++)
-			{
-				data[i] = functor->operator()(data[i]);
-			}
+			functor->transform_block(chars(), chars(), _size);
 		}
 
 		template <class Functor = defaultTransformer<charT>>
-		friend universalStrign transform(universalStrign& other, Functor functor = Functor()) {
-			auto result = universalStrign<charT>();
-			for (size_t i = 0; i < other.size(); i++)
-			{
-				result.push_back(functor(other[i]));
-			}
-			return universalStrign(result);
+		friend constexpr universalStrign transform(const universalStrign& other, Functor functor = Functor()) {
+			auto result = universalStrign(other._size);
+			transform_chars(other.chars(), result.chars(), other._size, functor);
+			return result;
 		}
 
-		friend universalStrign transformDyn(universalStrign& other, 
+		friend universalStrign transformDyn(const universalStrign& other,
 			ITransformer<charT>* functor) {
-			auto result = universalStrign<charT>();
-			for (size_t i = 0; i < other.size(); i++)
-			{
-				result.push_back(functor->operator()(other[i]));
-			}
-			return universalStrign(result);
+			auto result = universalStrign(other._size);
+			functor->transform_block(other.chars(), result.chars(), other._size);
+			return result;
 		}
 
-		friend std::istream& operator>>(std::istream& input, universalStrign& value) {
-			std::string temp;
-			try {
-				input >> temp;
+		// The parallel passes cut the characters into one chunk per pool thread, each at least
+		// MinChunk characters and starting on a cache line, and run them concurrently with
+		// the calling thread taking the first. Shorter strings run serially.
+
+		// Every chunk works on its own copy of functor.
+		template <class Functor>
+		void parallel_transform(Functor functor, thread_pool& pool = thread_pool::shared(), std::size_t MinChunk = 1 << 18);
+
+		std::size_t parallel_count(charT value, thread_pool& pool = thread_pool::shared(), std::size_t MinChunk = 1 << 18) const;
+
+		// Index of the first occurrence of value, or npos. Chunks past an earlier hit stop early.
+		std::size_t parallel_find(charT value, thread_pool& pool = thread_pool::shared(), std::size_t MinChunk = 1 << 18) const;
+
+		// Reduces chunks independently and folds them left to right onto init, so reduce
+		// must be associative but need not be commutative.
+		template <class Result, class Reduce, class Transform>
+		Result parallel_transform_reduce(Result init, Reduce reduce, Transform transform,
+			thread_pool& pool = thread_pool::shared(), std::size_t MinChunk = 1 << 18) const;
+
+		// Appends up to max characters straight from the stream's buffer into this string's
+		// storage and returns how many arrived; a short read sets eofbit.
+		std::size_t append_from(std::basic_istream<charT>& input, std::size_t max);
+
+		// Same from a file descriptor, for byte strings. Read errors throw std::system_error.
+		std::size_t append_from(int descriptor, std::size_t max) requires (sizeof(charT) == 1);
+
+		// Appends the next whitespace-delimited word, collected in blocks instead of going
+		// through a temporary std::string.
+		template <class streamCharT, class Traits>
+		friend std::basic_istream<streamCharT, Traits>& operator>>(std::basic_istream<streamCharT, Traits>& input, universalStrign& value) {
+			typename std::basic_istream<streamCharT, Traits>::sentry guard(input);
+			if (!guard) {
+				return input;
 			}
-			catch (const std::exception& ex) {
-				throw ex;
+			const auto& facet = std::use_facet<std::ctype<streamCharT>>(input.getloc());
+			auto* buffer = input.rdbuf();
+			charT block[256];
+			std::size_t filled = 0;
+			bool extracted = false;
+			for (auto next = buffer->sgetc();; next = buffer->snextc()) {
+				if (Traits::eq_int_type(next, Traits::eof())) {
+					input.setstate(std::ios_base::eofbit);
+					break;
+				}
+				streamCharT item = Traits::to_char_type(next);
+				if (facet.is(std::ctype_base::space, item)) {
+					break;
+				}
+				block[filled++] = static_cast<charT>(item);
+				extracted = true;
+				if (filled == std::size(block)) {
+					value.append(block, filled);
+					filled = 0;
+				}
 			}
-			for (auto item : temp) {
-				value.push_back(static_cast<charT>(item));
+			value.append(block, filled);
+			input.width(0);
+			if (!extracted) {
+				input.setstate(std::ios_base::failbit);
 			}
 			return input;
 		}
 
-		friend std::ostream& operator<<(std::ostream& out, universalStrign& value) {
-			for (size_t i = 0; i < value.size(); i++)
-			{
-				try {
-					out << value[i];
+		template <class streamCharT, class Traits>
+		friend std::basic_ostream<streamCharT, Traits>& operator<<(std::basic_ostream<streamCharT, Traits>& out, const universalStrign& value) {
+			return out << value.view();
+		}
+
+		// Replaces value with the characters up to delim, which is extracted but not stored.
+		friend std::basic_istream<charT>& getline(std::basic_istream<charT>& input, universalStrign& value, charT delim) {
+			using traits = typename std::basic_istream<charT>::traits_type;
+			value.clear();
+			typename std::basic_istream<charT>::sentry guard(input, true);
+			if (!guard) {
+				return input;
+			}
+			auto* buffer = input.rdbuf();
+			charT block[256];
+			std::size_t filled = 0;
+			bool extracted = false;
+			for (auto next = buffer->sgetc();; next = buffer->snextc()) {
+				if (traits::eq_int_type(next, traits::eof())) {
+					input.setstate(std::ios_base::eofbit);
+					break;
+				}
+				extracted = true;
+				if (traits::eq(traits::to_char_type(next), delim)) {
+					buffer->sbumpc();
+					break;
 				}
-				catch (const std::exception& ex) {
-					throw ex;
+				block[filled++] = traits::to_char_type(next);
+				if (filled == std::size(block)) {
+					value.append(block, filled);
+					filled = 0;
 				}
 			}
-			return out;
+			value.append(block, filled);
+			if (!extracted) {
+				input.setstate(std::ios_base::failbit);
+			}
+			return input;
+		}
+
+		friend std::basic_istream<charT>& getline(std::basic_istream<charT>& input, universalStrign& value) {
+			return getline(input, value, input.widen('\n'));
 		}
 
 	private:
+		constexpr const charT* chars() const { return data.data() + _offset; }
+
+		constexpr universalStrign_view<charT> view() const { return universalStrign_view<charT>(chars(), _size); }
+
+		constexpr charT* chars() { return data.data() + _offset; }
+
+		// Grows the string by count value-initialized characters and returns the first of
+		// them, for callers that fill storage in place; drop_back gives back what they did
+		// not use.
+		constexpr charT* extend(std::size_t count);
+
+		constexpr void drop_back(std::size_t count) {
+			_size -= count;
+			data.resize(_offset + _size + 1);
+			data[_offset + _size] = charT();
+		}
+
+		// Characters live in data[_offset, _offset + _size) followed by a terminator; the
+		// slack in front of _offset lets push_front and pop_front run in amortized O(1). A
+		// moved-from string holds no elements at all until restore_terminator runs.
+		constexpr void restore_terminator() {
+			if (!data.size()) {
+				data.push_back(charT());
+			}
+		}
+
+		constexpr void grow_front_slack();
+
+		constexpr void compact();
+
+		// Runs task(begin, count) over the chunks described above and returns the results in
+		// chunk order. Every chunk finishes before the first failure is rethrown.
+		template <class Task>
+		auto run_chunks(Task& task, thread_pool& pool, std::size_t MinChunk) const
+			-> std::vector<std::invoke_result_t<Task&, std::size_t, std::size_t>>;
+
+		std::size_t _offset;
 		std::size_t _size;
 		Container data;
 	};
 
 	template<class charT, class Container>
-	inline universalStrign<charT, Container>::universalStrign(universalStrign&& other) noexcept
-		: _size(other._size), data(std::move(other.data)) { other._size = 0; }
+	constexpr universalStrign<charT, Container>::universalStrign(universalStrign&& other) noexcept
+		: _offset(other._offset), _size(other._size), data(std::move(other.data))
+	{
+		// The source is left empty, without even a terminator, so that moving never
+		// allocates; it is put back when the source grows again.
+		other._offset = 0;
+		other._size = 0;
+		other.data.clear();
+	}
 
 	template<class charT, class Container>
-	universalStrign<charT, Container>::universalStrign(const charT* Array) : universalStrign()
+	constexpr universalStrign<charT, Container>::universalStrign(const charT* Array) : universalStrign()
 	{
-		for (std::size_t i = 0; Array[i] != 0; i++)
-		{
-			universalStrign<charT, Container>::push_back(Array[i]);
+		std::size_t length = 0;
+		while (Array[length] != 0) {
+			length++;
 		}
+		append(Array, length);
 	}
 
 	template<class charT, class Container>
-	universalStrign<charT, Container>::universalStrign(const charT* Array, const charT* ArrayEnd) : universalStrign()
+	constexpr universalStrign<charT, Container>::universalStrign(const charT* Array, const charT* ArrayEnd) : universalStrign()
 	{
-		for (std::size_t i = 0; Array + i != ArrayEnd; i++) {
-			universalStrign<charT>::push_back(Array[i]);
-		}
-		universalStrign<charT>::push_back(*ArrayEnd);
+		append(Array, ArrayEnd - Array + 1);
 	}
 
 	template<class charT, class Container>
-	universalStrign<charT, Container> universalStrign<charT, Container>::operator=(universalStrign<charT, Container>&& other) noexcept
+	constexpr universalStrign<charT, Container>& universalStrign<charT, Container>::operator=(universalStrign<charT, Container>&& other) noexcept
 	{
-		_size = other._size;
-		data = std::move(other.data);
-		other._size = 0;
+		if (this != &other) {
+			_offset = other._offset;
+			_size = other._size;
+			data = std::move(other.data);
+			other._offset = 0;
+			other._size = 0;
+			other.data.clear();
+		}
 		return *this;
 	}
 
 	template<class charT, class Container>
-	void universalStrign<charT, Container>::pop_front()
+	constexpr void universalStrign<charT, Container>::pop_front()
 	{
 		if (_size) {
-			std::size_t size = _size;
-			charT temp = data[0];
-			std::size_t i;
-			for (i = 0, size--; i < size; i++) data[i] = data[i + 1];
-			data[size] = temp;
-			universalStrign<charT>::pop_back();
+			data[_offset++] = charT();
+			_size--;
+			if (_offset > _size && _offset >= 16) {
+				compact();
+			}
 		}
 	}
 
 	template<class charT, class Container>
-	void universalStrign<charT, Container>::pop_back()
+	constexpr void universalStrign<charT, Container>::pop_back()
 	{
 		if (_size) {
 			data.pop_back();
-			data.pop_back();
-			data.push_back(charT());
-			_size--;
+			data[_offset + --_size] = charT();
 		}
 	}
 
 	template<class charT, class Container>
-	void universalStrign<charT, Container>::push_back(charT value)
+	constexpr void universalStrign<charT, Container>::push_back(charT value)
 	{
-		data[_size] = value;
+		restore_terminator();
+		data[_offset + _size] = value;
 		data.push_back(charT());
 		_size++;
 	}
 
 	template<class charT, class Container>
-	void universalStrign<charT, Container>::push_back(const universalStrign<charT, Container>& other)
+	constexpr void universalStrign<charT, Container>::push_back(const universalStrign<charT, Container>& other)
 	{
-		data.pop_back();
-		for (size_t i = 0; i < other.size(); i++)
+		append(other);
+	}
+
+	template<class charT, class Container>
+	constexpr void universalStrign<charT, Container>::append(const charT* Array, std::size_t count)
+	{
+		if (!count) {
+			return;
+		}
+		// Array may point into this string, so remember where before the buffer moves.
+		// Constant evaluation cannot order unrelated pointers, so it looks for Array instead.
+		const charT* own = data.data();
+		bool inside = false;
+		if (std::is_constant_evaluated()) {
+			for (std::size_t i = 0; i < data.size() && !inside; i++)
+			{
+				inside = Array == own + i;
+			}
+		}
+		else {
+			inside = !std::less<const charT*>()(Array, own) && std::less<const charT*>()(Array, own + data.size());
+		}
+		std::size_t position = inside ? Array - own : 0;
+		if (_size + count > capacity()) {
+			reserve(std::max(_size + count, 2 * capacity()));
+		}
+		if (inside) {
+			Array = data.data() + position;
+		}
+		std::copy(Array, Array + count, extend(count));
+	}
+
+	template<class charT, class Container>
+	constexpr charT* universalStrign<charT, Container>::extend(std::size_t count)
+	{
+		if (_size + count > capacity()) {
+			reserve(std::max(_size + count, 2 * capacity()));
+		}
+		std::size_t end = _offset + _size;
+		data.resize(end + count + 1);
+		data[end + count] = charT();
+		_size += count;
+		return data.data() + end;
+	}
+
+	template<class charT, class Container>
+	std::size_t universalStrign<charT, Container>::append_from(std::basic_istream<charT>& input, std::size_t max)
+	{
+		typename std::basic_istream<charT>::sentry guard(input, true);
+		if (!guard || !max) {
+			return 0;
+		}
+		charT* out = extend(max);
+		std::size_t arrived = static_cast<std::size_t>(input.rdbuf()->sgetn(out, static_cast<std::streamsize>(max)));
+		drop_back(max - arrived);
+		if (arrived < max) {
+			input.setstate(std::ios_base::eofbit);
+		}
+		return arrived;
+	}
+
+	template<class charT, class Container>
+	std::size_t universalStrign<charT, Container>::append_from(int descriptor, std::size_t max) requires (sizeof(charT) == 1)
+	{
+		charT* out = extend(max);
+#if defined(_WIN32)
+		auto arrived = ::_read(descriptor, out, static_cast<unsigned>(std::min<std::size_t>(max, INT_MAX)));
+#else
+		ssize_t arrived;
+		do {
+			arrived = ::read(descriptor, out, max);
+		} while (arrived < 0 && errno == EINTR);
+#endif
+		if (arrived < 0) {
+			int error = errno;
+			drop_back(max);
+			throw std::system_error(error, std::generic_category(), "Read error [universalStrign<charT>::append_from]");
+		}
+		drop_back(max - static_cast<std::size_t>(arrived));
+		return static_cast<std::size_t>(arrived);
+	}
+
+	template<class charT, class Container>
+	constexpr void universalStrign<charT, Container>::push_front(charT value)
+	{
+		if (!_offset) {
+			grow_front_slack();
+		}
+		data[--_offset] = value;
+		_size++;
+	}
+
+	template<class charT, class Container>
+	constexpr void universalStrign<charT, Container>::grow_front_slack()
+	{
+		// Doubling the slack keeps a stream of push_front calls amortized O(1).
+		restore_terminator();
+		std::size_t slack = std::max<std::size_t>(_size, 8);
+		std::size_t used = data.size();
+		data.resize(used + slack);
+		std::move_backward(data.begin(), data.begin() + used, data.end());
+		std::fill(data.begin(), data.begin() + slack, charT());
+		_offset = slack;
+	}
+
+	template<class charT, class Container>
+	constexpr void universalStrign<charT, Container>::compact()
+	{
+		std::move(data.begin() + _offset, data.begin() + _offset + _size + 1, data.begin());
+		data.resize(_size + 1);
+		_offset = 0;
+	}
+
+	template<class charT, class Container>
+	template <class Task>
+	auto universalStrign<charT, Container>::run_chunks(Task& task, thread_pool& pool, std::size_t MinChunk) const
+		-> std::vector<std::invoke_result_t<Task&, std::size_t, std::size_t>>
+	{
+		using result_type = std::invoke_result_t<Task&, std::size_t, std::size_t>;
+		std::vector<result_type> results;
+		std::size_t parts = std::min(pool.size(), _size / std::max<std::size_t>(MinChunk, 1));
+		if (parts < 2) {
+			results.push_back(task(0, _size));
+			return results;
+		}
+		std::vector<std::size_t> bounds(1, 0);
+		for (std::size_t i = 1; i < parts; i++)
 		{
-			data.push_back(other.data[i]);
+			std::size_t bound = _size * i / parts;
+			if constexpr (64 % sizeof(charT) == 0) {
+				// Round down to a cache line so no two chunks write the same line.
+				std::size_t shift = reinterpret_cast<std::uintptr_t>(chars() + bound) % 64 / sizeof(charT);
+				if (bound > bounds.back() + shift) {
+					bound -= shift;
+				}
+			}
+			bounds.push_back(bound);
 		}
-		data.push_back(charT());
-		_size += other.size();
+		bounds.push_back(_size);
+
+		std::vector<std::future<result_type>> pending;
+		for (std::size_t i = 1; i < parts; i++)
+		{
+			pending.push_back(pool.submit([&task, begin = bounds[i], end = bounds[i + 1]] { return task(begin, end - begin); }));
+		}
+		std::exception_ptr failure;
+		try {
+			results.push_back(task(0, bounds[1]));
+		}
+		catch (...) {
+			failure = std::current_exception();
+		}
+		for (auto& piece : pending) {
+			piece.wait();
+		}
+		if (failure) {
+			std::rethrow_exception(failure);
+		}
+		for (auto& piece : pending) {
+			results.push_back(piece.get());
+		}
+		return results;
+	}
+
+	template<class charT, class Container>
+	template <class Functor>
+	void universalStrign<charT, Container>::parallel_transform(Functor functor, thread_pool& pool, std::size_t MinChunk)
+	{
+		charT* first = chars();
+		auto task = [first, &functor](std::size_t begin, std::size_t count) {
+			Functor local = functor;
+			transform_chars(first + begin, first + begin, count, local);
+			return true;
+		};
+		run_chunks(task, pool, MinChunk);
+	}
+
+	template<class charT, class Container>
+	std::size_t universalStrign<charT, Container>::parallel_count(charT value, thread_pool& pool, std::size_t MinChunk) const
+	{
+		const charT* first = chars();
+		auto task = [first, &value](std::size_t begin, std::size_t count) -> std::size_t {
+			return std::count(first + begin, first + begin + count, value);
+		};
+		std::size_t total = 0;
+		for (std::size_t part : run_chunks(task, pool, MinChunk)) {
+			total += part;
+		}
+		return total;
+	}
+
+	template<class charT, class Container>
+	std::size_t universalStrign<charT, Container>::parallel_find(charT value, thread_pool& pool, std::size_t MinChunk) const
+	{
+		const charT* first = chars();
+		std::atomic<std::size_t> found(npos);
+		auto task = [first, &value, &found](std::size_t begin, std::size_t count) {
+			// Scan in slices so a chunk behind an earlier hit gives up quickly.
+			const std::size_t slice = 4096;
+			for (std::size_t at = begin; at < begin + count; at += slice)
+			{
+				if (found.load(std::memory_order_relaxed) < at) {
+					return npos;
+				}
+				const charT* end = first + std::min(at + slice, begin + count);
+				const charT* hit = std::find(first + at, end, value);
+				if (hit != end) {
+					std::size_t index = hit - first;
+					std::size_t current = found.load(std::memory_order_relaxed);
+					while (index < current && !found.compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+					}
+					return index;
+				}
+			}
+			return npos;
+		};
+		std::size_t result = npos;
+		for (std::size_t part : run_chunks(task, pool, MinChunk)) {
+			result = std::min(result, part);
+		}
+		return result;
 	}
 
 	template<class charT, class Container>
-	void universalStrign<charT, Container>::push_front(charT value)
+	template <class Result, class Reduce, class Transform>
+	Result universalStrign<charT, Container>::parallel_transform_reduce(Result init, Reduce reduce, Transform transform,
+		thread_pool& pool, std::size_t MinChunk) const
 	{
-		std::size_t size = _size;
-		charT temp = data[--size];
-		while (size > 0) {
-			data[size--] = data[size - 1];
+		if (!_size) {
+			return init;
 		}
-		universalStrign<charT>::push_back(temp);
-		data[0] = value;
+		const charT* first = chars();
+		auto task = [first, &reduce, &transform](std::size_t begin, std::size_t count) {
+			Result local = transform(first[begin]);
+			for (std::size_t i = begin + 1; i < begin + count; i++)
+			{
+				local = reduce(std::move(local), transform(first[i]));
+			}
+			return local;
+		};
+		for (auto& part : run_chunks(task, pool, MinChunk)) {
+			init = reduce(std::move(init), std::move(part));
+		}
+		return init;
 	}
 
 	template<class charT, class Container>
-	charT& universalStrign<charT, Container>::operator[](std::size_t index)
+	constexpr charT& universalStrign<charT, Container>::operator[](std::size_t index)
 	{
 		if (index < _size) {
-			return data[index];
+			return data[_offset + index];
 		}
 		else {
 			throw std::out_of_range("Out of range error [universalStrign<charT>::operator[]]");
 		}
 	}
 	template<class charT, class Container>
-	charT universalStrign<charT, Container>::operator[](std::size_t index) const
+	constexpr charT universalStrign<charT, Container>::operator[](std::size_t index) const
 	{
 		if (index < _size) {
-			return data[index];
+			return data[_offset + index];
 		}
 		else {
 			throw std::out_of_range("Out of range error [universalStrign<charT>::operator[]]");
 		}
 	}
 
+	template <class charT, class Functor>
+	universalStrign<charT> transform(universalStrign_view<charT> view, Functor functor) {
+		auto result = universalStrign<charT>(view.size());
+		if (!view.isEmpty()) {
+			transform_chars(view.data(), &result[0], view.size(), functor);
+		}
+		return result;
+	}
+
+	template <class charT>
+	universalStrign<charT> transformDyn(universalStrign_view<charT> view, ITransformer<charT>* functor) {
+		auto result = universalStrign<charT>(view.size());
+		if (!view.isEmpty()) {
+			functor->transform_block(view.data(), &result[0], view.size());
+		}
+		return result;
+	}
+
 	template<class charT, class Container = DefaultContainer<charT>>
 	universalStrign<charT, Container> make_string(const charT* value) { return universalStrign<charT, Container>(value); }
 
 	template<class charT, class Container = DefaultContainer<charT>>
 	static universalStrign<charT, Container> make_string(const charT* begin, const charT* end) { return universalStrign<charT, Container>(begin, end); }
 
+	// Converts between character types. Between UTF-8 (char, char8_t) and UTF-16 or UTF-32
+	// (char16_t, char32_t, wchar_t) it validates and transcodes, throwing std::range_error on
+	// malformed input; any other pair converts each character with static_cast. The result
+	// is allocated once, at its final length.
 	template <class T, class U>
-	universalStrign<T> convert(universalStrign<U>& str) {
-		universalStrign<T> result;
-		for (size_t i = 0; i < str.size(); i++) {
-			result.push_back(static_cast<T>(str[i]));
+	universalStrign<T> convert(universalStrign_view<U> str) {
+		if constexpr (utf_unit_size<T> && utf_unit_size<U> && utf_unit_size<T> != utf_unit_size<U>) {
+			auto result = universalStrign<T>(transcoded_length<T>(str.data(), str.size()));
+			if (!result.isEmpty()) {
+				transcode(str.data(), str.size(), &result[0]);
+			}
+			return result;
+		}
+		else {
+			auto result = universalStrign<T>(str.size());
+			if (!result.isEmpty()) {
+				T* out = &result[0];
+				for (std::size_t i = 0; i < str.size(); i++)
+				{
+					out[i] = static_cast<T>(str.data()[i]);
+				}
+			}
+			return result;
 		}
-		return result;
 	}
-}
\ No newline at end of file
+
+	template <class T, class U, class Container>
+	universalStrign<T> convert(const universalStrign<U, Container>& str) { return convert<T, U>(universalStrign_view<U>(str)); }
+
+	// Transparent hasher: with std::equal_to<> it lets an unordered container keyed by
+	// universalStrign be searched with a view, without building a key string.
+	struct universalStrign_hash {
+		using is_transparent = void;
+
+		template <class charT>
+		std::size_t operator()(universalStrign_view<charT> view) const { return hash_chars(view.data(), view.size()); }
+
+		template <class charT, class Container>
+		std::size_t operator()(const universalStrign<charT, Container>& value) const { return value.hash(); }
+	};
+}
+
+template <class charT, class Container>
+struct std::hash<my_std::universalStrign<charT, Container>> {
+	std::size_t operator()(const my_std::universalStrign<charT, Container>& value) const { return value.hash(); }
+};
\ No newline at end of file
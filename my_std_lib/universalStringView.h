@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "charKernels.h"
+#include "stringSearch.h"
+#include "stringHash.h"
+
+namespace my_std {
+
+	// Non-owning window (pointer and length) onto a run of characters, usually the inside
+	// of a universalStrign. It is invalidated by anything that reallocates or shifts the
+	// characters it looks at.
+	template <class charT>
+	class universalStrign_view {
+	public:
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+		constexpr universalStrign_view() noexcept : _begin(nullptr), _size(0) {}
+
+		constexpr universalStrign_view(const charT* Array, std::size_t size) noexcept : _begin(Array), _size(size) {}
+
+		constexpr universalStrign_view(const charT* Array) : _begin(Array), _size(0) {
+			// For the standard character types the length of a literal folds to a constant.
+			if constexpr (is_standard_char<charT>) {
+				_size = std::char_traits<charT>::length(Array);
+			}
+			else {
+				while (Array[_size] != 0) {
+					_size++;
+				}
+			}
+		}
+
+		constexpr std::size_t size() const noexcept { return _size; }
+
+		constexpr bool isEmpty() const noexcept { return !_size; }
+
+		constexpr const charT* data() const noexcept { return _begin; }
+
+		constexpr const charT* begin() const noexcept { return _begin; }
+
+		constexpr const charT* end() const noexcept { return _begin + _size; }
+
+		constexpr const charT& operator[](std::size_t index) const {
+			if (index < _size) {
+				return _begin[index];
+			}
+			else {
+				throw std::out_of_range("Out of range error [universalStrign_view<charT>::operator[]]");
+			}
+		}
+
+		// Characters [index, index + count), clipped to the end of the view.
+		constexpr universalStrign_view substr_view(std::size_t index, std::size_t count = npos) const {
+			if (index > _size) {
+				throw std::out_of_range("Out of range error [universalStrign_view<charT>::substr_view]");
+			}
+			return universalStrign_view(_begin + index, std::min(count, _size - index));
+		}
+
+		constexpr void remove_prefix(std::size_t count) noexcept { _begin += count; _size -= count; }
+
+		constexpr void remove_suffix(std::size_t count) noexcept { _size -= count; }
+
+		// Searches return the index of the match or npos; see searcher for the algorithms.
+		std::size_t find(universalStrign_view needle, std::size_t from = 0) const {
+			return searcher<charT>(needle._begin, needle._size).find(_begin, _size, from);
+		}
+
+		std::size_t find(const charT& value, std::size_t from = 0) const {
+			if (from >= _size) {
+				return npos;
+			}
+			std::size_t hit = find_char(_begin + from, _size - from, value);
+			return hit == npos ? npos : from + hit;
+		}
+
+		std::size_t find(const searcher<charT>& needle, std::size_t from = 0) const { return needle.find(_begin, _size, from); }
+
+		std::size_t rfind(universalStrign_view needle, std::size_t from = npos) const {
+			return searcher<charT>(needle._begin, needle._size).rfind(_begin, _size, from);
+		}
+
+		std::size_t rfind(const charT& value, std::size_t from = npos) const {
+			return rfind(universalStrign_view(&value, 1), from);
+		}
+
+		bool contains(universalStrign_view needle) const { return find(needle) != npos; }
+
+		bool contains(const charT& value) const { return find(value) != npos; }
+
+		std::size_t find_first_of(universalStrign_view set, std::size_t from = 0) const {
+			return find_first_of_chars(_begin, _size, set._begin, set._size, from);
+		}
+
+		// Non-overlapping occurrences of needle.
+		std::size_t count(universalStrign_view needle) const {
+			return searcher<charT>(needle._begin, needle._size).count(_begin, _size);
+		}
+
+		std::size_t count(const charT& value) const { return std::count(_begin, _begin + _size, value); }
+
+		friend constexpr bool operator==(universalStrign_view view1, universalStrign_view view2) {
+			return view1._size == view2._size && equal_chars(view1._begin, view2._begin, view1._size);
+		}
+
+		friend constexpr bool operator!=(universalStrign_view view1, universalStrign_view view2) {
+			return !(view1 == view2);
+		}
+
+		friend constexpr bool operator<(universalStrign_view view1, universalStrign_view view2) {
+			return compare_chars(view1._begin, view1._size, view2._begin, view2._size) < 0;
+		}
+
+		friend constexpr bool operator>(universalStrign_view view1, universalStrign_view view2) {
+			return view2 < view1;
+		}
+
+		friend constexpr bool operator<=(universalStrign_view view1, universalStrign_view view2) {
+			return !(view2 < view1);
+		}
+
+		friend constexpr bool operator>=(universalStrign_view view1, universalStrign_view view2) {
+			return !(view1 < view2);
+		}
+
+		// One write call when charT is the stream's character type, otherwise one insertion
+		// per character.
+		template <class streamCharT, class Traits>
+		friend std::basic_ostream<streamCharT, Traits>& operator<<(std::basic_ostream<streamCharT, Traits>& out, universalStrign_view view) {
+			if constexpr (std::is_same_v<charT, streamCharT>) {
+				out.write(view._begin, static_cast<std::streamsize>(view._size));
+			}
+			else {
+				for (const charT& item : view) {
+					out << item;
+				}
+			}
+			return out;
+		}
+
+	private:
+		const charT* _begin;
+		std::size_t _size;
+	};
+}
+
+template <class charT>
+struct std::hash<my_std::universalStrign_view<charT>> {
+	constexpr std::size_t operator()(my_std::universalStrign_view<charT> view) const { return my_std::hash_chars(view.data(), view.size()); }
+};
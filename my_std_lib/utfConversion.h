@@ -0,0 +1,284 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+#include "charKernels.h"
+
+namespace my_std {
+
+	// Bytes per code unit of the Unicode encoding a character type holds: 1 for UTF-8 (char,
+	// char8_t), 2 for UTF-16 and 4 for UTF-32 (char16_t, char32_t, and wchar_t by its size).
+	// Zero for types that are not text.
+	template <class charT>
+	inline constexpr std::size_t utf_unit_size =
+		std::is_same_v<charT, char> || std::is_same_v<charT, char8_t> ? 1
+		: std::is_same_v<charT, char16_t> || std::is_same_v<charT, char32_t> || std::is_same_v<charT, wchar_t> ? sizeof(charT)
+		: 0;
+
+	namespace utf_detail {
+
+		template <class charT>
+		std::uint32_t unit(charT value) {
+			return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<charT>>(value));
+		}
+
+		// Decodes the code point at first[index] and moves index past it. Throws
+		// std::range_error on overlong forms, surrogates, values above U+10FFFF and
+		// truncated sequences.
+		template <class charT>
+		char32_t decode(const charT* first, std::size_t count, std::size_t& index) {
+			std::uint32_t lead = unit(first[index]);
+			if constexpr (utf_unit_size<charT> == 1) {
+				std::size_t length;
+				std::uint32_t low = 0x80;
+				std::uint32_t high = 0xBF;
+				if (lead < 0x80) {
+					index++;
+					return lead;
+				}
+				else if (lead >= 0xC2 && lead <= 0xDF) {
+					length = 2;
+					lead &= 0x1F;
+				}
+				else if (lead >= 0xE0 && lead <= 0xEF) {
+					length = 3;
+					low = lead == 0xE0 ? 0xA0 : low;
+					high = lead == 0xED ? 0x9F : high;
+					lead &= 0x0F;
+				}
+				else if (lead >= 0xF0 && lead <= 0xF4) {
+					length = 4;
+					low = lead == 0xF0 ? 0x90 : low;
+					high = lead == 0xF4 ? 0x8F : high;
+					lead &= 0x07;
+				}
+				else {
+					throw std::range_error("Invalid UTF-8 sequence [convert]");
+				}
+				if (length > count - index) {
+					throw std::range_error("Truncated UTF-8 sequence [convert]");
+				}
+				for (std::size_t i = 1; i < length; i++)
+				{
+					std::uint32_t next = unit(first[index + i]);
+					if (next < low || next > high) {
+						throw std::range_error("Invalid UTF-8 sequence [convert]");
+					}
+					lead = lead << 6 | (next & 0x3F);
+					low = 0x80;
+					high = 0xBF;
+				}
+				index += length;
+				return static_cast<char32_t>(lead);
+			}
+			else if constexpr (utf_unit_size<charT> == 2) {
+				if (lead < 0xD800 || lead > 0xDFFF) {
+					index++;
+					return static_cast<char32_t>(lead);
+				}
+				std::uint32_t trail = index + 1 < count ? unit(first[index + 1]) : 0;
+				if (lead > 0xDBFF || trail < 0xDC00 || trail > 0xDFFF) {
+					throw std::range_error("Unpaired UTF-16 surrogate [convert]");
+				}
+				index += 2;
+				return static_cast<char32_t>(0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00));
+			}
+			else {
+				if (lead > 0x10FFFF || (lead >= 0xD800 && lead <= 0xDFFF)) {
+					throw std::range_error("Invalid UTF-32 code point [convert]");
+				}
+				index++;
+				return static_cast<char32_t>(lead);
+			}
+		}
+
+		// Code units of charT needed for the code point.
+		template <class charT>
+		std::size_t encoded_length(char32_t point) {
+			if constexpr (utf_unit_size<charT> == 1) {
+				return point < 0x80 ? 1 : point < 0x800 ? 2 : point < 0x10000 ? 3 : 4;
+			}
+			else if constexpr (utf_unit_size<charT> == 2) {
+				return point < 0x10000 ? 1 : 2;
+			}
+			else {
+				return 1;
+			}
+		}
+
+		template <class charT>
+		charT* encode(char32_t point, charT* out) {
+			if constexpr (utf_unit_size<charT> == 1) {
+				if (point < 0x80) {
+					*out++ = static_cast<charT>(point);
+				}
+				else if (point < 0x800) {
+					*out++ = static_cast<charT>(0xC0 | point >> 6);
+					*out++ = static_cast<charT>(0x80 | (point & 0x3F));
+				}
+				else if (point < 0x10000) {
+					*out++ = static_cast<charT>(0xE0 | point >> 12);
+					*out++ = static_cast<charT>(0x80 | (point >> 6 & 0x3F));
+					*out++ = static_cast<charT>(0x80 | (point & 0x3F));
+				}
+				else {
+					*out++ = static_cast<charT>(0xF0 | point >> 18);
+					*out++ = static_cast<charT>(0x80 | (point >> 12 & 0x3F));
+					*out++ = static_cast<charT>(0x80 | (point >> 6 & 0x3F));
+					*out++ = static_cast<charT>(0x80 | (point & 0x3F));
+				}
+			}
+			else if constexpr (utf_unit_size<charT> == 2) {
+				if (point < 0x10000) {
+					*out++ = static_cast<charT>(point);
+				}
+				else {
+					*out++ = static_cast<charT>(0xD800 + ((point - 0x10000) >> 10));
+					*out++ = static_cast<charT>(0xDC00 + ((point - 0x10000) & 0x3FF));
+				}
+			}
+			else {
+				*out++ = static_cast<charT>(point);
+			}
+			return out;
+		}
+
+		// Number of ASCII code units at the start of the run, tested a block at a time.
+		template <class charT>
+		std::size_t ascii_prefix(const charT* first, std::size_t count) {
+			std::size_t i = 0;
+#if defined(MY_STD_SSE2)
+			constexpr std::size_t lanes = 16 / sizeof(charT);
+			for (; i + lanes <= count; i += lanes)
+			{
+				__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+				unsigned wide;
+				if constexpr (sizeof(charT) == 1) {
+					wide = static_cast<unsigned>(_mm_movemask_epi8(block));
+				}
+				else if constexpr (sizeof(charT) == 2) {
+					__m128i high = _mm_and_si128(block, _mm_set1_epi16(static_cast<short>(0xFF80)));
+					wide = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128()))) & 0xFFFFu;
+				}
+				else {
+					__m128i high = _mm_and_si128(block, _mm_set1_epi32(static_cast<int>(0xFFFFFF80)));
+					wide = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128()))) & 0xFFFFu;
+				}
+				if (wide) {
+					return i + std::countr_zero(wide) / sizeof(charT);
+				}
+			}
+#endif
+			while (i < count && unit(first[i]) < 0x80) {
+				i++;
+			}
+			return i;
+		}
+
+		// Copies the leading ASCII code units to out, widening or narrowing 16 bytes of input
+		// at a time, and returns how many it copied.
+		template <class From, class To>
+		std::size_t copy_ascii(const From* first, To* out, std::size_t count) {
+			std::size_t i = 0;
+#if defined(MY_STD_SSE2)
+			const __m128i zero = _mm_setzero_si128();
+			if constexpr (sizeof(From) == 1 && sizeof(To) > 1) {
+				for (; i + 16 <= count; i += 16)
+				{
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+					if (_mm_movemask_epi8(block)) {
+						break;
+					}
+					__m128i low = _mm_unpacklo_epi8(block, zero);
+					__m128i high = _mm_unpackhi_epi8(block, zero);
+					__m128i* target = reinterpret_cast<__m128i*>(out + i);
+					if constexpr (sizeof(To) == 2) {
+						_mm_storeu_si128(target, low);
+						_mm_storeu_si128(target + 1, high);
+					}
+					else {
+						_mm_storeu_si128(target, _mm_unpacklo_epi16(low, zero));
+						_mm_storeu_si128(target + 1, _mm_unpackhi_epi16(low, zero));
+						_mm_storeu_si128(target + 2, _mm_unpacklo_epi16(high, zero));
+						_mm_storeu_si128(target + 3, _mm_unpackhi_epi16(high, zero));
+					}
+				}
+			}
+			else if constexpr (sizeof(From) == 2 && sizeof(To) == 1) {
+				const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+				for (; i + 16 <= count; i += 16)
+				{
+					const __m128i* source = reinterpret_cast<const __m128i*>(first + i);
+					__m128i block0 = _mm_loadu_si128(source);
+					__m128i block1 = _mm_loadu_si128(source + 1);
+					__m128i high = _mm_and_si128(_mm_or_si128(block0, block1), mask);
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) {
+						break;
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(block0, block1));
+				}
+			}
+			else if constexpr (sizeof(From) == 4 && sizeof(To) == 1) {
+				const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+				for (; i + 16 <= count; i += 16)
+				{
+					const __m128i* source = reinterpret_cast<const __m128i*>(first + i);
+					__m128i block0 = _mm_loadu_si128(source);
+					__m128i block1 = _mm_loadu_si128(source + 1);
+					__m128i block2 = _mm_loadu_si128(source + 2);
+					__m128i block3 = _mm_loadu_si128(source + 3);
+					__m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(block0, block1), _mm_or_si128(block2, block3)), mask);
+					if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) {
+						break;
+					}
+					__m128i low = _mm_packs_epi32(block0, block1);
+					__m128i upper = _mm_packs_epi32(block2, block3);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(low, upper));
+				}
+			}
+#endif
+			for (; i < count && unit(first[i]) < 0x80; i++)
+			{
+				out[i] = static_cast<To>(first[i]);
+			}
+			return i;
+		}
+	}
+
+	// Code units of To that transcode(first, count, out) writes. Validates the input and
+	// throws std::range_error when it is malformed.
+	template <class To, class From>
+	std::size_t transcoded_length(const From* first, std::size_t count) {
+		std::size_t length = 0;
+		for (std::size_t i = 0; i < count;)
+		{
+			std::size_t ascii = utf_detail::ascii_prefix(first + i, count - i);
+			i += ascii;
+			length += ascii;
+			while (i < count && utf_detail::unit(first[i]) >= 0x80) {
+				length += utf_detail::encoded_length<To>(utf_detail::decode(first, count, i));
+			}
+		}
+		return length;
+	}
+
+	// Transcodes between the Unicode encodings of From and To into out, which must have room
+	// for transcoded_length<To>(first, count) units, and returns the end of the output.
+	// Runs of ASCII are copied a block at a time.
+	template <class From, class To>
+	To* transcode(const From* first, std::size_t count, To* out) {
+		for (std::size_t i = 0; i < count;)
+		{
+			std::size_t ascii = utf_detail::copy_ascii(first + i, out, count - i);
+			i += ascii;
+			out += ascii;
+			while (i < count && utf_detail::unit(first[i]) >= 0x80) {
+				out = utf_detail::encode(utf_detail::decode(first, count, i), out);
+			}
+		}
+		return out;
+	}
+}